@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <bootstrap_summary.h>
+#include <host_simd.h>
+#include <input_encoding.h>
+#include <opencl_utilities.h>
+#include <xorwow_host.h>
+
+// Sweeps input size, replications and local_item_size and prints the cost of every stage as JSON:
+//   fastbootstrap_bench [--device gpu|cpu|all] [--sizes 1000,100000] [--replications 1000,10000]
+//                       [--local-sizes 32,64,128] [--repeats 5] [--seed 1] [--host]
+// Device stages are timed with OpenCL event profiling, program build and the host path with a wall clock.
+// Every number is the median over the repeats, in milliseconds.
+
+typedef struct t_bench_options {
+  std::string device_type;
+  std::vector<int> sizes;
+  std::vector<int> replications;
+  std::vector<int> local_sizes;
+  int repeats;
+  int seed;
+  bool host;
+} bench_options;
+
+static std::vector<int> parse_list(const char* arg) {
+  std::vector<int> out;
+  std::string s(arg);
+  size_t start = 0;
+  while (start <= s.size()) {
+    size_t end = s.find(',', start);
+    if (end == std::string::npos) {
+      end = s.size();
+    }
+    int value = atoi(s.substr(start, end - start).c_str());
+    if (value <= 0) {
+      throw bootstrap_error("list values must be > 0: " + s);
+    }
+    out.push_back(value);
+    start = end + 1;
+  }
+  return out;
+}
+
+static bench_options parse_options(int argc, char** argv) {
+  bench_options options;
+  options.device_type = "all";
+  options.sizes = parse_list("1000,100000,1000000");
+  options.replications = parse_list("1000,10000");
+  options.local_sizes = parse_list("32,64,128");
+  options.repeats = 5;
+  options.seed = 1;
+  options.host = false;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--host") {
+      options.host = true;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      throw bootstrap_error("missing value for " + arg);
+    }
+    const char* value = argv[++i];
+    if (arg == "--device") {
+      options.device_type = value;
+    } else if (arg == "--sizes") {
+      options.sizes = parse_list(value);
+    } else if (arg == "--replications") {
+      options.replications = parse_list(value);
+    } else if (arg == "--local-sizes") {
+      options.local_sizes = parse_list(value);
+    } else if (arg == "--repeats") {
+      options.repeats = std::max(1, atoi(value));
+    } else if (arg == "--seed") {
+      options.seed = atoi(value);
+    } else {
+      throw bootstrap_error("unknown option " + arg);
+    }
+  }
+  return options;
+}
+
+static double median(std::vector<double> v) {
+  std::sort(v.begin(), v.end());
+  size_t n = v.size();
+  return (n % 2) ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+}
+
+static double wall_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// start to end of a finished command, the event is released
+static double event_ms(cl_event event) {
+  cl_ulong start, end;
+  CHECK_CL_ERROR(clWaitForEvents(1, &event));
+  CHECK_CL_ERROR(clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, NULL));
+  CHECK_CL_ERROR(clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, NULL));
+  CHECK_CL_ERROR(clReleaseEvent(event));
+  return (end - start) * 1e-6;
+}
+
+static std::string device_string(cl_device_id device, cl_device_info info) {
+  size_t size = 0;
+  CHECK_CL_ERROR(clGetDeviceInfo(device, info, 0, NULL, &size));
+  std::string value(size, '\0');
+  CHECK_CL_ERROR(clGetDeviceInfo(device, info, size, &value[0], NULL));
+  return std::string(value.c_str());
+}
+
+static std::string json_string(const std::string& s) {
+  std::string out = "\"";
+  for (size_t i = 0; i < s.size(); i++) {
+    char c = s[i];
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if ((unsigned char) c < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      out += escaped;
+    } else {
+      out += c;
+    }
+  }
+  return out + "\"";
+}
+
+static size_t round_up(size_t n, size_t multiple) {
+  return ((n + multiple - 1) / multiple) * multiple;
+}
+
+static void bench_device(cl_device_id device, const bench_options& options, const kernel_source& source, bool first_device) {
+  cl_int err;
+  cl_context context = clCreateContext(NULL, 1, &device, NULL, NULL, &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_command_queue queue = clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, &err);
+  CHECK_CL_ERROR_AFTER(err);
+
+  std::chrono::steady_clock::time_point build_start = std::chrono::steady_clock::now();
+  cl_program program = clCreateProgramWithSource(context, 1, (const char **)&source.str, (const size_t *)&source.size, &err);
+  CHECK_CL_ERROR_AFTER(err);
+  err = clBuildProgram(program, 1, &device, NULL, NULL, NULL);
+  CHECK_CL_PROGRAM_ERROR(err, program, device);
+  CHECK_CL_ERROR_AFTER(err);
+  double build_ms = wall_ms(build_start);
+
+  cl_kernel init_kernel = clCreateKernel(program, "init_xorwow_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  const std::vector<cl_uint>& tables = xorwow_digit_tables();
+  cl_mem jump_tables = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, tables.size() * sizeof(cl_uint), (void *)&tables[0], &err);
+  CHECK_CL_ERROR_AFTER(err);
+  CHECK_CL_ERROR(clSetKernelArg(init_kernel, 4, sizeof(cl_mem), (void *)&jump_tables));
+  cl_kernel bootstrap_kernel = clCreateKernel(program, "bootstrap_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_kernel bootstrap_vec4_kernel = clCreateKernel(program, "bootstrap_vec4_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_kernel summation_kernel = clCreateKernel(program, "summation_bootstrap_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  const std::vector<cl_uint>& skip = xorwow_skip_tables();
+  cl_mem skip_tables = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, skip.size() * sizeof(cl_uint), (void *)&skip[0], &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_kernel group_kernel = clCreateKernel(program, "group_bootstrap_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  CHECK_CL_ERROR(clSetKernelArg(group_kernel, 6, sizeof(cl_mem), (void *)&skip_tables));
+  cl_kernel encoded_kernel = clCreateKernel(program, "encoded_bootstrap_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_kernel integer_kernel = clCreateKernel(program, "integer_bootstrap_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_kernel summary_kernel = clCreateKernel(program, "summary_partial_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  cl_kernel histogram_kernel = clCreateKernel(program, "histogram_kernel", &err);
+  CHECK_CL_ERROR_AFTER(err);
+  // the defaults of get_bootstrap_summary's groups and a typical dashboard histogram
+  const int summary_groups = 32;
+  const int summary_bins = 128;
+  const input_encoding encodings[] = { ENCODING_HALF, ENCODING_BFLOAT16, ENCODING_INT8, ENCODING_INT16 };
+  const int nr_encodings = sizeof(encodings) / sizeof(encodings[0]);
+  // the compensated accumulators in the order of enum summation_mode, naive is bootstrap_kernel itself
+  const char* summation_names[] = { "kahan", "pairwise", "fixed_point" };
+  const int summation_modes[] = { SUMMATION_KAHAN, SUMMATION_PAIRWISE, SUMMATION_FIXED_POINT };
+  const int nr_summations = sizeof(summation_modes) / sizeof(summation_modes[0]);
+  cl_uint vector_width;
+  CHECK_CL_ERROR(clGetDeviceInfo(device, CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT, sizeof(cl_uint), &vector_width, NULL));
+
+  printf("%s\n    {\n", first_device ? "" : ",");
+  printf("      \"device\": %s,\n", json_string(device_string(device, CL_DEVICE_NAME)).c_str());
+  printf("      \"vendor\": %s,\n", json_string(device_string(device, CL_DEVICE_VENDOR)).c_str());
+  printf("      \"driver\": %s,\n", json_string(device_string(device, CL_DRIVER_VERSION)).c_str());
+  printf("      \"opencl_version\": %s,\n", json_string(device_string(device, CL_DEVICE_VERSION)).c_str());
+  printf("      \"preferred_vector_width_int\": %u,\n", vector_width);
+  printf("      \"program_build_ms\": %.6f,\n", build_ms);
+  printf("      \"runs\": [");
+
+  bool first_run = true;
+  int sequence_offset = 0;
+  for (size_t r = 0; r < options.replications.size(); r++) {
+    int replications = options.replications[r];
+    cl_mem rand_states = clCreateBuffer(context, CL_MEM_READ_WRITE, replications * sizeof(xorwow_state), NULL, &err);
+    CHECK_CL_ERROR_AFTER(err);
+    cl_mem output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, replications * sizeof(float), NULL, &err);
+    CHECK_CL_ERROR_AFTER(err);
+    std::vector<float> h_out(replications);
+    cl_mem partials = clCreateBuffer(context, CL_MEM_READ_WRITE, summary_groups * summary_moments * sizeof(double), NULL, &err);
+    CHECK_CL_ERROR_AFTER(err);
+    cl_mem histogram = clCreateBuffer(context, CL_MEM_READ_WRITE, summary_bins * sizeof(cl_uint), NULL, &err);
+    CHECK_CL_ERROR_AFTER(err);
+    std::vector<double> h_partials(summary_groups * summary_moments);
+    std::vector<cl_uint> h_histogram(summary_bins);
+
+    for (size_t l = 0; l < options.local_sizes.size(); l++) {
+      size_t local_size = options.local_sizes[l];
+      size_t global_size = round_up(replications, local_size);
+
+      std::vector<double> init_ms;
+      for (int k = 0; k < options.repeats; k++) {
+        cl_event event;
+        CHECK_CL_ERROR(clSetKernelArg(init_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+        CHECK_CL_ERROR(clSetKernelArg(init_kernel, 1, sizeof(int), (void *)&replications));
+        CHECK_CL_ERROR(clSetKernelArg(init_kernel, 2, sizeof(int), (void *)&options.seed));
+        CHECK_CL_ERROR(clSetKernelArg(init_kernel, 3, sizeof(int), (void *)&sequence_offset));
+        CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, init_kernel, 1, NULL, &global_size, &local_size, 0, NULL, &event));
+        init_ms.push_back(event_ms(event));
+      }
+
+      for (size_t s = 0; s < options.sizes.size(); s++) {
+        int nr_values = options.sizes[s];
+        std::vector<float> x(nr_values);
+        for (int i = 0; i < nr_values; i++) {
+          x[i] = (float) (i % 1000);
+        }
+        cl_mem values = clCreateBuffer(context, CL_MEM_READ_ONLY, nr_values * sizeof(float), NULL, &err);
+        CHECK_CL_ERROR_AFTER(err);
+        std::vector<cl_mem> encoded_values_buffers(nr_encodings);
+        std::vector<encoded_values> encoded(nr_encodings);
+        for (int e = 0; e < nr_encodings; e++) {
+          encode_values(&x[0], nr_values, encodings[e], &encoded[e]);
+          encoded_values_buffers[e] = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, encoded[e].bytes.size(), (void *)&encoded[e].bytes[0], &err);
+          CHECK_CL_ERROR_AFTER(err);
+        }
+        // the same values as counts, 0 .. 999 take 2 bytes each
+        std::vector<int> counts(x.begin(), x.end());
+        encoded_integers integers;
+        encode_integers(&counts[0], nr_values, &integers);
+        cl_mem integer_values = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, integers.bytes.size(), (void *)&integers.bytes[0], &err);
+        CHECK_CL_ERROR_AFTER(err);
+        cl_long integer_offset = integers.offset;
+
+        std::vector<double> upload_ms, kernel_ms, vec4_kernel_ms, group_kernel_ms, integer_kernel_ms, readback_ms, summary_kernel_ms, summary_readback_ms, host_ms;
+        std::vector<std::vector<double> > summation_ms(nr_summations);
+        std::vector<std::vector<double> > encoded_ms(nr_encodings);
+        int subsample = 0;
+        int fixed_point_bits = host_fixed_point_bits(999, nr_values);
+        for (int k = 0; k < options.repeats; k++) {
+          cl_event event;
+          CHECK_CL_ERROR(clEnqueueWriteBuffer(queue, values, CL_FALSE, 0, nr_values * sizeof(float), &x[0], 0, NULL, &event));
+          upload_ms.push_back(event_ms(event));
+
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 2, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 3, sizeof(cl_mem), (void *)&values));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 4, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 5, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, bootstrap_kernel, 1, NULL, &global_size, &local_size, 0, NULL, &event));
+          kernel_ms.push_back(event_ms(event));
+
+          // four replications per work item, it writes the same output
+          size_t vec4_global_size = round_up((replications + 3) / 4, local_size);
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_vec4_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_vec4_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_vec4_kernel, 2, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_vec4_kernel, 3, sizeof(cl_mem), (void *)&values));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_vec4_kernel, 4, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(bootstrap_vec4_kernel, 5, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, bootstrap_vec4_kernel, 1, NULL, &vec4_global_size, &local_size, 0, NULL, &event));
+          vec4_kernel_ms.push_back(event_ms(event));
+
+          // a work group per replication
+          size_t group_global_size = (size_t) replications * local_size;
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 2, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 3, sizeof(cl_mem), (void *)&values));
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 4, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 5, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(group_kernel, 7, local_size * sizeof(float), NULL));
+          CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, group_kernel, 1, NULL, &group_global_size, &local_size, 0, NULL, &event));
+          group_kernel_ms.push_back(event_ms(event));
+
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 2, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 3, sizeof(cl_mem), (void *)&values));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 4, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 5, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 6, sizeof(int), (void *)&subsample));
+          CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 8, sizeof(int), (void *)&fixed_point_bits));
+          for (int m = 0; m < nr_summations; m++) {
+            CHECK_CL_ERROR(clSetKernelArg(summation_kernel, 7, sizeof(int), (void *)&summation_modes[m]));
+            CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, summation_kernel, 1, NULL, &global_size, &local_size, 0, NULL, &event));
+            summation_ms[m].push_back(event_ms(event));
+          }
+
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 2, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 3, sizeof(cl_mem), (void *)&integer_values));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 4, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 5, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 6, sizeof(int), (void *)&subsample));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 7, sizeof(int), (void *)&integers.value_bytes));
+          CHECK_CL_ERROR(clSetKernelArg(integer_kernel, 8, sizeof(cl_long), (void *)&integer_offset));
+          CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, integer_kernel, 1, NULL, &global_size, &local_size, 0, NULL, &event));
+          integer_kernel_ms.push_back(event_ms(event));
+
+          CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 0, sizeof(cl_mem), (void *)&rand_states));
+          CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 2, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 4, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 5, sizeof(int), (void *)&nr_values));
+          CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 6, sizeof(int), (void *)&subsample));
+          for (int e = 0; e < nr_encodings; e++) {
+            int encoding_id = encodings[e];
+            CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 3, sizeof(cl_mem), (void *)&encoded_values_buffers[e]));
+            CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 7, sizeof(int), (void *)&encoding_id));
+            CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 8, sizeof(float), (void *)&encoded[e].scale));
+            CHECK_CL_ERROR(clSetKernelArg(encoded_kernel, 9, sizeof(float), (void *)&encoded[e].offset));
+            CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, encoded_kernel, 1, NULL, &global_size, &local_size, 0, NULL, &event));
+            encoded_ms[e].push_back(event_ms(event));
+          }
+
+          CHECK_CL_ERROR(clEnqueueReadBuffer(queue, output, CL_FALSE, 0, replications * sizeof(float), &h_out[0], 0, NULL, &event));
+          readback_ms.push_back(event_ms(event));
+
+          // the summary of the same output: both reduction kernels and the read of partials and histogram
+          size_t summary_local_size = std::min(local_size, (size_t) 256);
+          size_t summary_global_size = summary_groups * summary_local_size;
+          cl_uint zero = 0;
+          CHECK_CL_ERROR(clEnqueueFillBuffer(queue, histogram, &zero, sizeof(cl_uint), 0, summary_bins * sizeof(cl_uint), 0, NULL, NULL));
+          CHECK_CL_ERROR(clSetKernelArg(summary_kernel, 0, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(summary_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(summary_kernel, 2, sizeof(cl_mem), (void *)&partials));
+          CHECK_CL_ERROR(clSetKernelArg(summary_kernel, 3, 4 * summary_local_size * sizeof(cl_double), NULL));
+          CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, summary_kernel, 1, NULL, &summary_global_size, &summary_local_size, 0, NULL, &event));
+          double summary_ms = event_ms(event);
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 0, sizeof(cl_mem), (void *)&output));
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 1, sizeof(int), (void *)&replications));
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 2, sizeof(cl_mem), (void *)&partials));
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 3, sizeof(int), (void *)&summary_groups));
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 4, sizeof(int), (void *)&summary_bins));
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 5, sizeof(cl_mem), (void *)&histogram));
+          CHECK_CL_ERROR(clSetKernelArg(histogram_kernel, 6, summary_bins * sizeof(cl_uint), NULL));
+          CHECK_CL_ERROR(clEnqueueNDRangeKernel(queue, histogram_kernel, 1, NULL, &summary_global_size, &summary_local_size, 0, NULL, &event));
+          summary_kernel_ms.push_back(summary_ms + event_ms(event));
+          CHECK_CL_ERROR(clEnqueueReadBuffer(queue, partials, CL_FALSE, 0, h_partials.size() * sizeof(double), &h_partials[0], 0, NULL, &event));
+          summary_ms = event_ms(event);
+          CHECK_CL_ERROR(clEnqueueReadBuffer(queue, histogram, CL_FALSE, 0, summary_bins * sizeof(cl_uint), &h_histogram[0], 0, NULL, &event));
+          summary_readback_ms.push_back(summary_ms + event_ms(event));
+
+          // the host path (rand states and the vectorised bootstrap_kernel, cpu_bootstrap_manager's fallback) does not
+          // depend on the local size, it is timed once per input size
+          if (options.host && l == 0) {
+            std::vector<xorwow_state> host_states(replications);
+            std::vector<float> host_out(replications);
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            host_init_rand_states(options.seed, 0, replications, &host_states[0]);
+            host_bootstrap_states(&host_states[0], replications, &x[0], nr_values, nr_values, &host_out[0]);
+            host_ms.push_back(wall_ms(start));
+          }
+        }
+        CHECK_CL_ERROR(clReleaseMemObject(values));
+        for (int e = 0; e < nr_encodings; e++) {
+          CHECK_CL_ERROR(clReleaseMemObject(encoded_values_buffers[e]));
+        }
+        CHECK_CL_ERROR(clReleaseMemObject(integer_values));
+
+        double kernel = median(kernel_ms);
+        printf("%s\n        {\"nr_values\": %d, \"replications\": %d, \"local_item_size\": %d, ", first_run ? "" : ",", nr_values, replications, (int) local_size);
+        printf("\"init_xorwow_ms\": %.6f, \"upload_ms\": %.6f, \"bootstrap_kernel_ms\": %.6f, \"bootstrap_vec4_kernel_ms\": %.6f, \"group_bootstrap_kernel_ms\": %.6f, \"readback_ms\": %.6f, ", median(init_ms), median(upload_ms), kernel, median(vec4_kernel_ms), median(group_kernel_ms), median(readback_ms));
+        printf("\"draws_per_second\": %.1f, \"summation_ms\": {", (double) nr_values * replications / std::max(kernel * 1e-3, 1e-12));
+        for (int m = 0; m < nr_summations; m++) {
+          printf("%s\"%s\": %.6f", m == 0 ? "" : ", ", summation_names[m], median(summation_ms[m]));
+        }
+        printf("}, \"integer_bootstrap_kernel_ms\": %.6f, \"encoded_ms\": {", median(integer_kernel_ms));
+        for (int e = 0; e < nr_encodings; e++) {
+          printf("%s\"%s\": %.6f", e == 0 ? "" : ", ", input_encoding_name(encodings[e]), median(encoded_ms[e]));
+        }
+        printf("}, \"summary_kernel_ms\": %.6f, \"summary_readback_ms\": %.6f", median(summary_kernel_ms), median(summary_readback_ms));
+        if (!host_ms.empty()) {
+          printf(", \"host_ms\": %.6f", median(host_ms));
+        }
+        printf("}");
+        first_run = false;
+      }
+    }
+    CHECK_CL_ERROR(clReleaseMemObject(rand_states));
+    CHECK_CL_ERROR(clReleaseMemObject(output));
+    CHECK_CL_ERROR(clReleaseMemObject(partials));
+    CHECK_CL_ERROR(clReleaseMemObject(histogram));
+  }
+  printf("\n      ]\n    }");
+
+  CHECK_CL_ERROR(clReleaseMemObject(jump_tables));
+  CHECK_CL_ERROR(clReleaseKernel(init_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(bootstrap_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(bootstrap_vec4_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(summation_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(group_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(encoded_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(integer_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(summary_kernel));
+  CHECK_CL_ERROR(clReleaseKernel(histogram_kernel));
+  CHECK_CL_ERROR(clReleaseMemObject(skip_tables));
+  CHECK_CL_ERROR(clReleaseProgram(program));
+  CHECK_CL_ERROR(clReleaseCommandQueue(queue));
+  CHECK_CL_ERROR(clReleaseContext(context));
+}
+
+int main(int argc, char** argv) {
+  try {
+    bench_options options = parse_options(argc, argv);
+    std::vector<cl_device_id> devices = get_opencl_devices(parse_device_type(options.device_type));
+    if (devices.empty()) {
+      throw bootstrap_error("no OpenCL device of type '" + options.device_type + "' found");
+    }
+    kernel_source source = get_kernel_source(kernel_source_path().c_str());
+
+    printf("{\n  \"benchmark\": \"fastbootstrap\",\n  \"repeats\": %d,\n  \"seed\": %d,\n", options.repeats, options.seed);
+    if (options.host) {
+      printf("  \"host_isa\": \"%s\",\n", host_simd_isa());
+    }
+    printf("  \"devices\": [");
+    for (size_t d = 0; d < devices.size(); d++) {
+      bench_device(devices[d], options, source, d == 0);
+    }
+    printf("\n  ]\n}\n");
+    free(source.str);
+  } catch (const std::exception& e) {
+    fflush(stdout);
+    fprintf(stderr, "fastbootstrap_bench: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,551 @@
+#ifndef BOOTSTRAP_DAEMON_H
+#define BOOTSTRAP_DAEMON_H
+
+#ifndef _WIN32
+
+// A local daemon that owns one OpenCL context, program and rand state buffer for all processes on a host.
+// Clients send a request over a Unix domain socket together with a file descriptor of a shared memory
+// region, which holds the input values followed by room for the bootstrapped means.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <bootstrap_error.h>
+
+#define BOOTSTRAP_DAEMON_MAGIC (0x46425344u)
+#define BOOTSTRAP_DAEMON_MAX_CLIENTS (256)
+
+enum daemon_op {
+  DAEMON_OP_BOOTSTRAP = 1,
+  DAEMON_OP_SHUTDOWN = 2
+};
+
+typedef struct t_daemon_request {
+  uint32_t magic;
+  uint32_t op;
+  int32_t replications;
+  int32_t seed;
+  int32_t nr_values;
+  int32_t resample_size;
+  int32_t sampling;
+  int32_t compression;
+} daemon_request;
+
+typedef struct t_daemon_response {
+  uint32_t magic;
+  int32_t status;
+  char message[248];
+} daemon_response;
+
+static const char* daemon_sampling_names[] = { "replacement", "subsampling" };
+static const char* daemon_compression_names[] = { "auto", "always", "never" };
+
+inline int daemon_name_index(const char** names, int nr_names, const std::string& name) {
+  for (int i = 0; i < nr_names; i++) {
+    if (name == names[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+inline void daemon_socket_address(const std::string& socket_path, sockaddr_un* address) {
+  if (socket_path.size() >= sizeof(address->sun_path)) {
+    throw bootstrap_error("socket path is too long: " + socket_path);
+  }
+  memset(address, 0, sizeof(sockaddr_un));
+  address->sun_family = AF_UNIX;
+  strncpy(address->sun_path, socket_path.c_str(), sizeof(address->sun_path) - 1);
+}
+
+// sends the request and, if fd >= 0, passes the shared memory descriptor along with it
+inline bool daemon_send(int socket_fd, const void* data, size_t size, int fd) {
+  iovec iov;
+  iov.iov_base = (void*) data;
+  iov.iov_len = size;
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  char control[CMSG_SPACE(sizeof(int))];
+  if (fd >= 0) {
+    memset(control, 0, sizeof(control));
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+  }
+  int flags = 0;
+#ifdef MSG_NOSIGNAL
+  flags = MSG_NOSIGNAL;
+#endif
+  ssize_t sent;
+  do {
+    sent = sendmsg(socket_fd, &msg, flags);
+  } while (sent < 0 && errno == EINTR);
+  return sent == (ssize_t) size;
+}
+
+// blocking read of a fixed size message and the descriptor passed with it (-1 if there is none), for the client
+inline bool daemon_receive(int socket_fd, void* data, size_t size, int* fd) {
+  iovec iov;
+  iov.iov_base = data;
+  iov.iov_len = size;
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  char control[CMSG_SPACE(sizeof(int))];
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t received;
+  do {
+    received = recvmsg(socket_fd, &msg, MSG_WAITALL);
+  } while (received < 0 && errno == EINTR);
+  if (fd) {
+    *fd = -1;
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+      memcpy(fd, CMSG_DATA(cmsg), sizeof(int));
+    }
+  }
+  return received == (ssize_t) size;
+}
+
+// A request in the making on the daemon side. Its socket is non-blocking, so a client that sends slowly or only a
+// part of its request leaves the bytes so far here instead of stalling the other clients.
+typedef struct t_daemon_client {
+  int fd;
+  int memory_fd;
+  size_t received;
+  daemon_request request;
+} daemon_client;
+
+inline daemon_client daemon_accept(int listen_fd) {
+  daemon_client client;
+  client.fd = accept(listen_fd, NULL, NULL);
+  client.memory_fd = -1;
+  client.received = 0;
+  if (client.fd >= 0) {
+    int flags = fcntl(client.fd, F_GETFL);
+    if (flags < 0 || fcntl(client.fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+      close(client.fd);
+      client.fd = -1;
+    }
+  }
+  return client;
+}
+
+// reads what is there of the client's request: 1 once it is complete, 0 while parts are missing and -1 if the
+// client hung up or broke the protocol
+inline int daemon_receive_partial(daemon_client* client) {
+  iovec iov;
+  iov.iov_base = (char*) &client->request + client->received;
+  iov.iov_len = sizeof(daemon_request) - client->received;
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  char control[CMSG_SPACE(sizeof(int))];
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t received;
+  do {
+    received = recvmsg(client->fd, &msg, 0);
+  } while (received < 0 && errno == EINTR);
+  if (received < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  if (cmsg && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+    int fd;
+    memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    // a request carries at most one descriptor
+    if (client->memory_fd >= 0) {
+      close(fd);
+      return -1;
+    }
+    client->memory_fd = fd;
+  }
+  if (received == 0) {
+    return -1;
+  }
+  client->received += received;
+  return (client->received == sizeof(daemon_request)) ? 1 : 0;
+}
+
+inline void daemon_close_client(daemon_client* client) {
+  if (client->memory_fd >= 0) {
+    close(client->memory_fd);
+  }
+  close(client->fd);
+}
+
+// anonymous shared memory: a memfd sealed against shrinking on Linux, which the daemon insists on,
+// an immediately unlinked shm_open object elsewhere
+inline int daemon_create_shared_memory(size_t size) {
+  int fd = -1;
+#ifdef __linux__
+  fd = memfd_create("fastbootstrap", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+#else
+  std::string name = "/fastbootstrap_" + std::to_string(getpid()) + "_" + std::to_string((unsigned long) &fd);
+  fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd >= 0) {
+    shm_unlink(name.c_str());
+  }
+#endif
+  if (fd < 0) {
+    throw bootstrap_error(std::string("could not create shared memory: ") + strerror(errno));
+  }
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    throw bootstrap_error(std::string("could not size shared memory: ") + strerror(errno));
+  }
+#ifdef __linux__
+  if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK) != 0) {
+    close(fd);
+    throw bootstrap_error(std::string("could not seal shared memory: ") + strerror(errno));
+  }
+#endif
+  return fd;
+}
+
+// A mapping past the end of the client's memory raises SIGBUS in the daemon, which would take it down for every
+// client. So the memory must hold the request now and, on Linux, be sealed so that the client cannot shrink it later.
+inline bool daemon_memory_fits(int memory_fd, size_t size) {
+  struct stat memory_stat;
+  if (fstat(memory_fd, &memory_stat) != 0 || memory_stat.st_size < 0 || (size_t) memory_stat.st_size < size) {
+    return false;
+  }
+#ifdef __linux__
+  int seals = fcntl(memory_fd, F_GET_SEALS);
+  if (seals < 0 || !(seals & F_SEAL_SHRINK)) {
+    return false;
+  }
+#endif
+  return true;
+}
+
+inline int daemon_connect(const std::string& socket_path) {
+  sockaddr_un address;
+  daemon_socket_address(socket_path, &address);
+  int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (socket_fd < 0 || connect(socket_fd, (sockaddr*) &address, sizeof(address)) != 0) {
+    if (socket_fd >= 0) {
+      close(socket_fd);
+    }
+    throw bootstrap_error("could not connect to the bootstrap daemon at " + socket_path + ": " + strerror(errno));
+  }
+  return socket_fd;
+}
+
+typedef struct t_daemon_job {
+  int client_fd;
+  int memory_fd;
+  daemon_request request;
+} daemon_job;
+
+// manager_t is an opencl_bootstrap_manager, created on the first request and afterwards only re-parameterized.
+// Every poll round is a batching point: the jobs of all clients are grouped by (replications, seed), so each
+// group needs a single rand state initialisation, and all jobs of a group are in flight on the device together.
+template <typename manager_t, typename T>
+void serve_bootstrap_daemon(const std::string& socket_path) {
+  sockaddr_un address;
+  daemon_socket_address(socket_path, &address);
+  unlink(socket_path.c_str());
+  int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  // the socket is created with 0600 right away, a chmod after bind would leave it open to others in between
+  mode_t old_umask = umask(0077);
+  int bound = (listen_fd < 0) ? -1 : bind(listen_fd, (sockaddr*) &address, sizeof(address));
+  int bind_errno = errno;
+  umask(old_umask);
+  errno = bind_errno;
+  if (listen_fd < 0 || bound != 0 || listen(listen_fd, 64) != 0) {
+    throw bootstrap_error("could not listen on " + socket_path + ": " + strerror(errno));
+  }
+
+  manager_t* manager = NULL;
+  std::pair<int, int> current_parameters;
+  std::vector<daemon_client> clients;
+  bool running = true;
+
+  while (running) {
+    std::vector<pollfd> fds(1 + clients.size());
+    fds[0].fd = listen_fd;
+    // while full the pending connections wait in the backlog, a readable listen_fd would wake poll right away
+    fds[0].events = (clients.size() < BOOTSTRAP_DAEMON_MAX_CLIENTS) ? POLLIN : 0;
+    for (size_t c = 0; c < clients.size(); c++) {
+      fds[c + 1].fd = clients[c].fd;
+      fds[c + 1].events = POLLIN;
+    }
+    if (poll(&fds[0], fds.size(), -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+
+    std::map<std::pair<int, int>, std::vector<daemon_job> > groups;
+    std::vector<daemon_client> open_clients;
+    for (size_t c = 0; c < clients.size(); c++) {
+      daemon_client& client = clients[c];
+      int complete = (fds[c + 1].revents & (POLLIN | POLLHUP | POLLERR)) ? daemon_receive_partial(&client) : 0;
+      if (complete < 0 || (complete > 0 && client.request.magic != BOOTSTRAP_DAEMON_MAGIC)) {
+        daemon_close_client(&client);
+        continue;
+      }
+      if (complete == 0) {
+        open_clients.push_back(client);
+        continue;
+      }
+      daemon_job job;
+      job.client_fd = client.fd;
+      job.memory_fd = client.memory_fd;
+      job.request = client.request;
+      client.memory_fd = -1;
+      client.received = 0;
+      open_clients.push_back(client);
+      if (job.request.op == DAEMON_OP_SHUTDOWN) {
+        if (job.memory_fd >= 0) {
+          close(job.memory_fd);
+        }
+        running = false;
+        continue;
+      }
+      groups[std::make_pair(job.request.replications, job.request.seed)].push_back(job);
+    }
+    clients.swap(open_clients);
+
+    for (typename std::map<std::pair<int, int>, std::vector<daemon_job> >::iterator group = groups.begin(); group != groups.end(); ++group) {
+      std::vector<daemon_job>& jobs = group->second;
+      std::vector<T*> memory(jobs.size(), (T*) MAP_FAILED);
+      std::vector<int> handles(jobs.size(), 0);
+      std::vector<daemon_response> responses(jobs.size());
+      std::string group_error;
+      try {
+        if (!manager) {
+          manager = new manager_t(group->first.first, group->first.second);
+        } else if (group->first != current_parameters) {
+          manager->set_parameters(group->first.first, group->first.second);
+        }
+        current_parameters = group->first;
+      } catch (std::exception& e) {
+        group_error = e.what();
+      }
+
+      for (size_t j = 0; j < jobs.size(); j++) {
+        daemon_request& request = jobs[j].request;
+        daemon_response& response = responses[j];
+        memset(&response, 0, sizeof(response));
+        response.magic = BOOTSTRAP_DAEMON_MAGIC;
+        try {
+          if (!group_error.empty()) {
+            throw bootstrap_error(group_error);
+          }
+          if (jobs[j].memory_fd < 0 || request.nr_values <= 0 || request.replications <= 0 ||
+              request.sampling < 0 || request.sampling > 1 || request.compression < 0 || request.compression > 2) {
+            throw bootstrap_error("malformed request");
+          }
+          size_t size = ((size_t) request.nr_values + request.replications) * sizeof(T);
+          if (!daemon_memory_fits(jobs[j].memory_fd, size)) {
+            throw bootstrap_error("malformed request");
+          }
+          memory[j] = (T*) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, jobs[j].memory_fd, 0);
+          if (memory[j] == (T*) MAP_FAILED) {
+            throw bootstrap_error(std::string("could not map the shared memory: ") + strerror(errno));
+          }
+          manager->set_resample_size(request.resample_size);
+          manager->set_sampling_mode(daemon_sampling_names[request.sampling]);
+          manager->set_compression(daemon_compression_names[request.compression]);
+          std::vector<T> x(memory[j], memory[j] + request.nr_values);
+          handles[j] = manager->submit(x);
+        } catch (std::exception& e) {
+          response.status = -1;
+          strncpy(response.message, e.what(), sizeof(response.message) - 1);
+        }
+      }
+
+      for (size_t j = 0; j < jobs.size(); j++) {
+        daemon_request& request = jobs[j].request;
+        daemon_response& response = responses[j];
+        if (handles[j] > 0) {
+          try {
+            std::vector<T> h_out = manager->collect(handles[j]);
+            memcpy(memory[j] + request.nr_values, &h_out[0], h_out.size() * sizeof(T));
+          } catch (std::exception& e) {
+            response.status = -1;
+            strncpy(response.message, e.what(), sizeof(response.message) - 1);
+          }
+        }
+        if (memory[j] != (T*) MAP_FAILED) {
+          munmap(memory[j], ((size_t) request.nr_values + request.replications) * sizeof(T));
+        }
+        if (jobs[j].memory_fd >= 0) {
+          close(jobs[j].memory_fd);
+        }
+        // the reply must go out whole, a client that does not read it is cut off and dropped by the next poll
+        if (!daemon_send(jobs[j].client_fd, &response, sizeof(response), -1)) {
+          shutdown(jobs[j].client_fd, SHUT_RDWR);
+        }
+      }
+    }
+
+    if ((fds[0].revents & POLLIN) && clients.size() < BOOTSTRAP_DAEMON_MAX_CLIENTS) {
+      daemon_client client = daemon_accept(listen_fd);
+      if (client.fd >= 0) {
+        clients.push_back(client);
+      }
+    }
+  }
+
+  for (size_t c = 0; c < clients.size(); c++) {
+    daemon_close_client(&clients[c]);
+  }
+  close(listen_fd);
+  unlink(socket_path.c_str());
+  if (manager) {
+    manager->cleanup_device();
+    delete manager;
+  }
+}
+
+// client side counterpart of opencl_bootstrap_manager for processes that share a daemon
+template <typename T>
+class bootstrap_daemon_client {
+
+  public:
+
+    bootstrap_daemon_client(std::string socket_path_, int replications_, int seed_)
+    {
+      socket_path = socket_path_;
+      set_parameters(replications_, seed_);
+      resample_size = 0;
+      sampling = 0;
+      compression = 0;
+      socket_fd = daemon_connect(socket_path);
+    }
+
+    void set_parameters(int replications_, int seed_) {
+      if (replications_ <= 0) {
+        throw bootstrap_error("the nr of replications must be > 0");
+      }
+      replications = replications_;
+      seed = seed_;
+    }
+
+    void set_resample_size(int resample_size_) {
+      if (resample_size_ < 0) {
+        throw bootstrap_error("the resample size must be >= 0 (0 uses the length of the input)");
+      }
+      resample_size = resample_size_;
+    }
+
+    void set_sampling_mode(std::string mode) {
+      int index = daemon_name_index(daemon_sampling_names, 2, mode);
+      if (index < 0) {
+        throw bootstrap_error("unknown sampling mode '" + mode + "', use 'replacement' or 'subsampling'");
+      }
+      sampling = index;
+    }
+
+    void set_compression(std::string mode) {
+      int index = daemon_name_index(daemon_compression_names, 3, mode);
+      if (index < 0) {
+        throw bootstrap_error("unknown compression mode '" + mode + "', use 'auto', 'always' or 'never'");
+      }
+      compression = index;
+    }
+
+    std::vector<T> get_bootstrapped_means(std::vector<T> x) {
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      size_t size = (x.size() + replications) * sizeof(T);
+      int memory_fd = daemon_create_shared_memory(size);
+      T* memory = (T*) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, memory_fd, 0);
+      if (memory == (T*) MAP_FAILED) {
+        close(memory_fd);
+        throw bootstrap_error(std::string("could not map the shared memory: ") + strerror(errno));
+      }
+      memcpy(memory, &x[0], x.size() * sizeof(T));
+
+      daemon_request request;
+      memset(&request, 0, sizeof(request));
+      request.magic = BOOTSTRAP_DAEMON_MAGIC;
+      request.op = DAEMON_OP_BOOTSTRAP;
+      request.replications = replications;
+      request.seed = seed;
+      request.nr_values = x.size();
+      request.resample_size = resample_size;
+      request.sampling = sampling;
+      request.compression = compression;
+
+      daemon_response response;
+      bool ok = daemon_send(socket_fd, &request, sizeof(request), memory_fd) &&
+        daemon_receive(socket_fd, &response, sizeof(response), NULL);
+      close(memory_fd);
+      std::vector<T> h_out(memory + x.size(), memory + x.size() + replications);
+      munmap(memory, size);
+
+      if (!ok || response.magic != BOOTSTRAP_DAEMON_MAGIC) {
+        throw bootstrap_error("lost the connection to the bootstrap daemon at " + socket_path);
+      }
+      if (response.status != 0) {
+        response.message[sizeof(response.message) - 1] = '\0';
+        throw bootstrap_error(std::string("bootstrap daemon: ") + response.message);
+      }
+      return(h_out);
+    }
+
+    ~bootstrap_daemon_client() {
+
+    };
+
+    void disconnect() {
+      if (socket_fd >= 0) {
+        close(socket_fd);
+        socket_fd = -1;
+      }
+    }
+
+  private:
+
+    std::string socket_path;
+    int socket_fd = -1;
+    int replications;
+    int seed;
+    int resample_size;
+    int sampling;
+    int compression;
+};
+
+inline void shutdown_bootstrap_daemon(std::string socket_path) {
+  int socket_fd = daemon_connect(socket_path);
+  daemon_request request;
+  memset(&request, 0, sizeof(request));
+  request.magic = BOOTSTRAP_DAEMON_MAGIC;
+  request.op = DAEMON_OP_SHUTDOWN;
+  daemon_send(socket_fd, &request, sizeof(request), -1);
+  close(socket_fd);
+}
+
+#endif
+
+#endif
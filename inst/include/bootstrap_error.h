@@ -0,0 +1,13 @@
+#ifndef BOOTSTRAP_ERROR_H
+#define BOOTSTRAP_ERROR_H
+
+#include <stdexcept>
+#include <string>
+
+// every error of the engine, OpenCL failures included. The R module turns it into an R error.
+class bootstrap_error : public std::runtime_error {
+  public:
+    explicit bootstrap_error(const std::string& message) : std::runtime_error(message) {}
+};
+
+#endif
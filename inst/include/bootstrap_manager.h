@@ -0,0 +1,2124 @@
+#ifndef BOOTSTRAP_MANAGER_H
+#define BOOTSTRAP_MANAGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <exception>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <opencl_utilities.h>
+#include <bootstrap_summary.h>
+#include <host_simd.h>
+#include <input_encoding.h>
+#include <opencl_profile.h>
+#include <rand_state_cache.h>
+#include <tuning_db.h>
+#include <xorwow_host.h>
+
+// the bootstrap engine, free of R: errors are thrown as bootstrap_error
+
+enum sampling_mode {
+  SAMPLE_WITH_REPLACEMENT,
+  SAMPLE_WITHOUT_REPLACEMENT
+};
+
+enum compression_mode {
+  COMPRESS_AUTO,
+  COMPRESS_ALWAYS,
+  COMPRESS_NEVER
+};
+
+enum group_mode {
+  GROUP_AUTO,
+  GROUP_ALWAYS,
+  GROUP_NEVER
+};
+
+enum input_kind {
+  INPUT_VALUES,
+  INPUT_INTEGERS,
+  INPUT_WEIGHTED,
+  INPUT_CATEGORIES,
+  INPUT_BINARY
+};
+
+// "naive" (float sum, the default), "kahan", "pairwise" or "fixed" (exact 64-bit fixed-point sum)
+inline summation_mode parse_summation_mode(const std::string& mode) {
+  if (mode == "naive") {
+    return SUMMATION_NAIVE;
+  } else if (mode == "kahan") {
+    return SUMMATION_KAHAN;
+  } else if (mode == "pairwise") {
+    return SUMMATION_PAIRWISE;
+  } else if (mode == "fixed") {
+    return SUMMATION_FIXED_POINT;
+  }
+  throw bootstrap_error("unknown summation '" + mode + "', use 'naive', 'kahan', 'pairwise' or 'fixed'");
+}
+
+// the largest absolute value, which sets the fixed-point scale
+template <typename T>
+double max_abs_value(const T* values, int nr_values) {
+  double max_abs = 0;
+  for (int i = 0; i < nr_values; i++) {
+    double v = std::fabs((double) values[i]);
+    if (!std::isfinite(v)) {
+      throw bootstrap_error("fixed-point summation needs finite values");
+    }
+    max_abs = std::max(max_abs, v);
+  }
+  return max_abs;
+}
+
+typedef struct t_device_input {
+  input_kind kind;
+  int nr_values;
+  int nr_categories;
+  int successes;
+  int draws;
+  // of the values, only filled in for fixed-point summation
+  double max_abs;
+  // the storage of values, with the scale and offset of the int8 / int16 codes
+  input_encoding encoding;
+  float scale;
+  float offset;
+  // integer input is stored as value - integer_offset in value_bytes
+  int value_bytes;
+  cl_long integer_offset;
+  cl_mem values;
+  cl_mem alias_prob;
+  cl_mem alias_index;
+  cl_mem conditional_probs;
+} device_input;
+
+// the completion flag is shared with the event callback, which may still run after the job is collected
+typedef std::shared_ptr<std::atomic<bool> > completion_flag;
+
+template <typename T>
+struct bootstrap_job {
+  device_input input;
+  cl_mem output;
+  cl_event read_event;
+  std::vector<T> h_out;
+  completion_flag finished;
+  call_profile profile;
+};
+
+// everything whose arguments change per call, so threads that hold different lanes never share kernel arguments
+typedef struct t_execution_lane {
+  cl_command_queue queue;
+  cl_kernel bootstrap_kernel;
+  cl_kernel bootstrap_vec4_kernel;
+  cl_kernel summation_bootstrap_kernel;
+  cl_kernel group_bootstrap_kernel;
+  cl_kernel encoded_bootstrap_kernel;
+  cl_kernel integer_bootstrap_kernel;
+  cl_kernel subsample_kernel;
+  cl_kernel weighted_bootstrap_kernel;
+  cl_kernel multinomial_bootstrap_kernel;
+  cl_kernel binomial_bootstrap_kernel;
+  cl_kernel summary_partial_kernel;
+  cl_kernel histogram_kernel;
+  cl_mem output;
+  int generation;
+} execution_lane;
+
+typedef struct t_pipeline_slot {
+  cl_mem values;
+  cl_mem output;
+  cl_event kernel_event;
+  cl_event read_event;
+} pipeline_slot;
+
+// The bootstrap calls (get_bootstrapped_means*, submit/ready/wait/collect and calc_bootstrap_range) may be used from
+// several threads at once, each call takes its own execution lane. The set_* methods, jackknife and cleanup_device
+// must not run concurrently with anything else.
+template <typename T>
+class opencl_bootstrap_manager {
+  
+  public:
+
+    opencl_bootstrap_manager(int replications_, int seed_)
+    {
+      set_default_device_id();
+      init(replications_, seed_, 0);
+    }
+    
+    opencl_bootstrap_manager(int replications_, int seed_, cl_device_id device_id_, int sequence_offset_)
+    {
+      device_id = device_id_;
+      init(replications_, seed_, sequence_offset_);
+    }
+  
+    void set_parameters(int replications_, int seed_) {
+      setup_replications(replications_, seed_, sequence_offset);
+    }
+    
+    void set_shard(int replications_, int seed_, int sequence_offset_) {
+      setup_replications(replications_, seed_, sequence_offset_);
+    }
+  
+    void set_local_item_size(int item_size) {
+      local_item_size = (size_t) item_size;
+      global_item_size = global_size_for(replications);
+    }
+
+    // directory for rand state snapshots that outlive the process, "" keeps them in memory only
+    void set_state_cache(std::string directory) {
+      state_directory = directory;
+    }
+
+    void set_resample_size(int resample_size_) {
+      if (resample_size_ < 0) {
+        throw bootstrap_error("the resample size must be >= 0 (0 uses the length of the input)");
+      }
+      resample_size = resample_size_;
+    }
+    
+    void set_sampling_mode(std::string mode) {
+      if (mode == "replacement") {
+        sampling = SAMPLE_WITH_REPLACEMENT;
+      } else if (mode == "subsampling") {
+        sampling = SAMPLE_WITHOUT_REPLACEMENT;
+      } else {
+        throw bootstrap_error("unknown sampling mode '" + mode + "', use 'replacement' or 'subsampling'");
+      }
+    }
+
+    void set_compression(std::string mode) {
+      if (mode == "auto") {
+        compression = COMPRESS_AUTO;
+      } else if (mode == "always") {
+        compression = COMPRESS_ALWAYS;
+      } else if (mode == "never") {
+        compression = COMPRESS_NEVER;
+      } else {
+        throw bootstrap_error("unknown compression mode '" + mode + "', use 'auto', 'always' or 'never'");
+      }
+    }
+
+    // "gather" runs one replication per work item, "vec4" four as uint4 / float4 vectors. Both give the same means.
+    void set_kernel_variant(std::string variant) {
+      if (variant == "gather") {
+        vec4_variant = false;
+      } else if (variant == "vec4") {
+        vec4_variant = true;
+      } else {
+        throw bootstrap_error("unknown kernel variant '" + variant + "', use 'gather' or 'vec4'");
+      }
+    }
+    
+    std::string get_kernel_variant() {
+      return vec4_variant ? "vec4" : "gather";
+    }
+    
+    // a work group instead of a work item per replication of the plain bootstrap: 'auto' decides by the nr of
+    // replications against the draws per replication, 'always' or 'never' force it. The draws are the same,
+    // but they are added in another order, so the means may differ in the last bits.
+    void set_group_per_replication(std::string mode) {
+      if (mode == "auto") {
+        group_per_replication = GROUP_AUTO;
+      } else if (mode == "always") {
+        group_per_replication = GROUP_ALWAYS;
+      } else if (mode == "never") {
+        group_per_replication = GROUP_NEVER;
+      } else {
+        throw bootstrap_error("unknown group mode '" + mode + "', use 'auto', 'always' or 'never'");
+      }
+    }
+    
+    // any other accumulator than "naive" runs summation_bootstrap_kernel and turns off compression
+    void set_summation(std::string mode) {
+      summation = parse_summation_mode(mode);
+    }
+    
+    // "float" (default), "half", "bf16", "int8" or "int16" storage of uncompressed values on the device,
+    // encoding_errors tells how far each one is off for an input
+    void set_input_encoding(std::string name) {
+      encoding = parse_input_encoding(name);
+    }
+    
+    // only the plain kernels, which sum the draws in the order of cpu_bootstrap_manager, so the means match it bit for bit
+    void set_deterministic(bool enabled) {
+      deterministic = enabled;
+    }
+
+    // queue properties are fixed at creation, so switching recreates the queues and empties the lane pool
+    void set_profiling(bool enabled) {
+      if (enabled == profiling) {
+        return;
+      }
+      release_lanes();
+      release_queues();
+      profiling = enabled;
+      create_queues();
+    }
+    
+    // every write, kernel and read of the last finished call
+    std::vector<profile_record> get_last_profile() {
+      std::lock_guard<std::mutex> lock(profile_mutex);
+      return last_profile;
+    }
+    
+    profile_counters get_profile_counters() {
+      std::lock_guard<std::mutex> lock(profile_mutex);
+      return counters;
+    }
+    
+    void reset_profile_counters() {
+      std::lock_guard<std::mutex> lock(profile_mutex);
+      counters = profile_counters();
+    }
+
+    std::vector<T> get_bootstrapped_means(std::vector<T> x) {
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      std::vector<T> h_out(replications);
+      call_profile profile(profiling);
+      calc_bootstrap_on_gpu(&x[0], &h_out[0], x.size(), &profile);
+      publish_profile(profile);
+      return(h_out);
+    }
+
+    // metric k is uploaded on upload_queue, bootstrapped on the lane's queue and read back on readback_queue,
+    // so the upload of k+1, the kernel of k and the readback of k-1 overlap. Two slots of buffers take turns.
+    std::vector<std::vector<T> > get_bootstrapped_means_batch(std::vector<std::vector<T> > xs) {
+      cl_int err;
+      size_t nr_metrics = xs.size();
+      std::vector<std::vector<T> > h_out(nr_metrics, std::vector<T>(replications));
+      size_t max_values = 1;
+      for (size_t k = 0; k < nr_metrics; k++) {
+        if (xs[k].empty()) {
+          throw bootstrap_error("every vector in the batch needs at least one value");
+        }
+        max_values = std::max(max_values, xs[k].size());
+      }
+      
+      call_profile profile(profiling);
+      lane_guard lane(this);
+      pipeline_slot slots[2];
+      for (int s = 0; s < 2; s++) {
+        slots[s].values = clCreateBuffer(context, CL_MEM_READ_ONLY, max_values * sizeof(T), NULL, &err);
+        CHECK_CL_ERROR_AFTER(err);
+        slots[s].output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, replications * sizeof(T), NULL, &err);
+        CHECK_CL_ERROR_AFTER(err);
+        slots[s].kernel_event = NULL;
+        slots[s].read_event = NULL;
+      }
+      std::vector<encoded_values> encoded(nr_metrics);
+      
+      for (size_t k = 0; k < nr_metrics; k++) {
+        pipeline_slot& slot = slots[k % 2];
+        int nr_values = xs[k].size();
+        std::vector<cl_event> kernel_waits;
+        
+        device_input input = {};
+        bool compressed = try_compress(&xs[k][0], nr_values, &input, &profile);
+        if (!compressed) {
+          // the kernel two metrics back must be done reading the slot before it is overwritten
+          cl_event upload_event;
+          input.kind = INPUT_VALUES;
+          input.nr_values = nr_values;
+          input.draws = nr_values;
+          input.max_abs = (summation == SUMMATION_FIXED_POINT) ? max_abs_value(&xs[k][0], nr_values) : 0;
+          input.values = slot.values;
+          const void* upload_data = &xs[k][0];
+          size_t upload_bytes = nr_values * sizeof(T);
+          if (encoding != ENCODING_FLOAT) {
+            // the write is asynchronous, so the encoded copy lives until the end of the batch
+            encode_values(&xs[k][0], nr_values, encoding, &encoded[k]);
+            set_encoding(&input, encoded[k]);
+            upload_data = &encoded[k].bytes[0];
+            upload_bytes = encoded[k].bytes.size();
+          }
+          CHECK_CL_ERROR(clEnqueueWriteBuffer(upload_queue, slot.values, CL_FALSE, 0, upload_bytes, upload_data, slot.kernel_event ? 1 : 0, slot.kernel_event ? &slot.kernel_event : NULL, &upload_event));
+          profile.track("write", "values", upload_bytes, upload_event);
+          kernel_waits.push_back(upload_event);
+        }
+        if (slot.read_event) {
+          kernel_waits.push_back(slot.read_event);
+        }
+        
+        cl_event kernel_event;
+        cl_event read_event;
+        enqueue_bootstrap(lane.get(), input, slot.output, &profile, kernel_waits.size(), kernel_waits.empty() ? NULL : &kernel_waits[0], &kernel_event);
+        CHECK_CL_ERROR(clEnqueueReadBuffer(readback_queue, slot.output, CL_FALSE, 0, replications * sizeof(T), &h_out[k][0], 1, &kernel_event, &read_event));
+        profile.track("read", "output", replications * sizeof(T), read_event);
+        if (compressed) {
+          // deleted by the runtime once the kernel is done with it
+          release_input(input);
+        } else {
+          CHECK_CL_ERROR(clReleaseEvent(kernel_waits[0]));
+        }
+        release_slot_events(slot);
+        slot.kernel_event = kernel_event;
+        slot.read_event = read_event;
+        
+        CHECK_CL_ERROR(clFlush(upload_queue));
+        CHECK_CL_ERROR(clFlush(lane->queue));
+        CHECK_CL_ERROR(clFlush(readback_queue));
+      }
+      
+      CHECK_CL_ERROR(clFinish(readback_queue));
+      for (int s = 0; s < 2; s++) {
+        release_slot_events(slots[s]);
+        CHECK_CL_ERROR(clReleaseMemObject(slots[s].values));
+        CHECK_CL_ERROR(clReleaseMemObject(slots[s].output));
+      }
+      publish_profile(profile);
+      return(h_out);
+    }
+
+    std::vector<T> get_weighted_bootstrapped_means(std::vector<T> x, std::vector<double> weights, bool frequency_weights) {
+      if (x.size() != weights.size()) {
+        throw bootstrap_error("values and weights must have the same length");
+      }
+      std::vector<T> h_out(replications);
+      call_profile profile(profiling);
+      device_input input = upload_weighted(&x[0], &weights[0], x.size(), frequency_weights, &profile);
+      lane_guard lane(this);
+      run_bootstrap(lane.get(), input, &h_out[0], &profile);
+      publish_profile(profile);
+      return(h_out);
+    }
+
+    // counts and other integer metrics without the detour through T, whose float loses integers above 2^24.
+    // The sums are exact, so the means are the same on every device and work-group size.
+    std::vector<T> get_bootstrapped_means_int(std::vector<int> x) {
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      std::vector<T> h_out(replications);
+      call_profile profile(profiling);
+      device_input input = upload_integers(&x[0], x.size(), &profile);
+      lane_guard lane(this);
+      run_bootstrap(lane.get(), input, &h_out[0], &profile);
+      publish_profile(profile);
+      return(h_out);
+    }
+
+    // the standard error, quantiles and an nr_bins histogram of the means, reduced on the device so that only a
+    // few hundred bytes are read back instead of replications floats
+    bootstrap_summary get_bootstrap_summary(std::vector<T> x, int nr_bins, std::vector<double> probs) {
+      check_summary_arguments(nr_bins, probs);
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      std::vector<double> partials;
+      std::vector<unsigned int> counts;
+      call_profile profile(profiling);
+      device_input input = upload_values(&x[0], x.size(), &profile);
+      {
+        lane_guard lane(this);
+        enqueue_bootstrap(lane.get(), input, lane->output, &profile);
+        summarise_on_gpu(lane.get(), nr_bins, &partials, &counts, &profile);
+      }
+      release_input(input);
+      publish_profile(profile);
+      return finish_summary(partials, counts, replications, probs);
+    }
+
+    int submit(std::vector<T> x) {
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      cl_int err;
+      std::unique_ptr<bootstrap_job<T> > job(new bootstrap_job<T>());
+      job->h_out.resize(replications);
+      job->finished = completion_flag(new std::atomic<bool>(false));
+      job->profile.enable(profiling);
+      job->input = upload_values(&x[0], x.size(), &job->profile);
+      job->output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, replications * sizeof(T), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      
+      // the arguments are captured at enqueue time, so the lane can go back to the pool right after the flush
+      {
+        lane_guard lane(this);
+        enqueue_bootstrap(lane.get(), job->input, job->output, &job->profile);
+        CHECK_CL_ERROR(clEnqueueReadBuffer(lane->queue, job->output, CL_FALSE, 0, replications * sizeof(T), &job->h_out[0], 0, NULL, &job->read_event));
+        job->profile.track("read", "output", replications * sizeof(T), job->read_event);
+        CHECK_CL_ERROR(clSetEventCallback(job->read_event, CL_COMPLETE, &job_completed, new completion_flag(job->finished)));
+        CHECK_CL_ERROR(clFlush(lane->queue));
+      }
+      
+      std::lock_guard<std::mutex> lock(jobs_mutex);
+      int handle = next_job_handle++;
+      jobs[handle] = std::move(job);
+      return handle;
+    }
+    
+    bool ready(int handle) {
+      std::lock_guard<std::mutex> lock(jobs_mutex);
+      return find_job(handle)->finished->load();
+    }
+    
+    void wait(int handle) {
+      cl_event read_event;
+      {
+        std::lock_guard<std::mutex> lock(jobs_mutex);
+        read_event = find_job(handle)->read_event;
+      }
+      CHECK_CL_ERROR(clWaitForEvents(1, &read_event));
+    }
+    
+    std::vector<T> collect(int handle) {
+      std::unique_ptr<bootstrap_job<T> > job;
+      {
+        std::lock_guard<std::mutex> lock(jobs_mutex);
+        find_job(handle);
+        job = std::move(jobs[handle]);
+        jobs.erase(handle);
+      }
+      cl_int status;
+      CHECK_CL_ERROR(clWaitForEvents(1, &job->read_event));
+      CHECK_CL_ERROR(clGetEventInfo(job->read_event, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(cl_int), &status, NULL));
+      std::vector<T> h_out;
+      h_out.swap(job->h_out);
+      if (status == CL_COMPLETE) {
+        publish_profile(job->profile);
+      }
+      release_job(job.get());
+      CHECK_CL_ERROR(status);
+      return(h_out);
+    }
+
+    // building blocks for schedulers that hand out ranges of replications to several devices
+    device_input upload(std::vector<T>& x) {
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      call_profile profile(profiling);
+      device_input input = upload_values(&x[0], x.size(), &profile);
+      publish_profile(profile);
+      return input;
+    }
+    
+    void release(device_input& input) {
+      release_input(input);
+    }
+    
+    // replications first .. first + count - 1 via the global work offset, read back into h_out[0 .. count - 1]
+    void calc_bootstrap_range(const device_input& input, int first, int count, T* h_out) {
+      call_profile profile(profiling);
+      lane_guard lane(this);
+      cl_kernel kernel = prepare_bootstrap_kernel(lane.get(), input, count);
+      size_t global_offset = first;
+      size_t global_size = replication_global_size(lane.get(), kernel, count);
+      // the kernels stop at their replications argument, which ends the range here so that the padding of the last
+      // work group does not compute the next chunk. Arguments are captured at enqueue, bind_lane's bound is restored.
+      int end = first + count;
+      CHECK_CL_ERROR(clSetKernelArg(kernel, 1, sizeof(int), (void *)&end));
+      CHECK_CL_ERROR(clSetKernelArg(kernel, 2, sizeof(cl_mem), (void *)&lane->output));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(lane->queue, kernel, 1, &global_offset, &global_size, &local_item_size, 0, NULL, profile.kernel_event(kernel)));
+      CHECK_CL_ERROR(clSetKernelArg(kernel, 1, sizeof(int), (void *)&replications));
+      CHECK_CL_ERROR(clEnqueueReadBuffer(lane->queue, lane->output, CL_TRUE, first * sizeof(T), count * sizeof(T), h_out, 0, NULL, profile.event("read", "output", count * sizeof(T))));
+      publish_profile(profile);
+    }
+
+    std::vector<T> jackknife(std::vector<T> x, std::string statistic, bool summary_only) {
+      int nr_values = x.size();
+      std::vector<T> h_out(nr_values);
+      call_profile profile(profiling);
+      if (statistic == "mean") {
+        if (nr_values < 2) {
+          throw bootstrap_error("the jackknife of the mean needs at least 2 values");
+        }
+        calc_jackknife_mean_on_gpu(&x[0], &h_out[0], nr_values, &profile);
+      } else if (statistic == "var") {
+        if (nr_values < 3) {
+          throw bootstrap_error("the jackknife of the variance needs at least 3 values");
+        }
+        calc_jackknife_var_on_gpu(&x[0], &h_out[0], nr_values, &profile);
+      } else {
+        throw bootstrap_error("unknown statistic '" + statistic + "', use 'mean' or 'var'");
+      }
+      publish_profile(profile);
+      if (summary_only) {
+        return(jackknife_acceleration_and_se(h_out));
+      }
+      return(h_out);
+    }
+  
+    ~opencl_bootstrap_manager() {
+
+    };
+    
+    void cleanup_device() {
+      for (typename std::map<int, std::unique_ptr<bootstrap_job<T> > >::iterator it = jobs.begin(); it != jobs.end(); ++it) {
+        CHECK_CL_ERROR(clWaitForEvents(1, &it->second->read_event));
+        release_job(it->second.get());
+      }
+      jobs.clear();
+      release_lanes();
+      release_queues();
+      CHECK_CL_ERROR(clReleaseProgram(program));
+      CHECK_CL_ERROR(clReleaseContext(context));
+      CHECK_CL_ERROR(clReleaseKernel(init_xorwow_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(jackknife_mean_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(jackknife_var_kernel));
+      CHECK_CL_ERROR(clReleaseMemObject(buffer_rand_states));
+      CHECK_CL_ERROR(clReleaseMemObject(buffer_jump_tables));
+      CHECK_CL_ERROR(clReleaseMemObject(buffer_skip_tables));
+    }
+    
+    // Times the plain bootstrap kernel, as gather and as vec4 variant, for every allowed work-group size on a small
+    // and a large input with the current replications, keeps the fastest and stores it in the tuning database for
+    // later managers on this device.
+    int autotune() {
+      sampling_mode user_sampling = sampling;
+      int user_resample_size = resample_size;
+      bool user_vec4_variant = vec4_variant;
+      size_t user_local_item_size = local_item_size;
+      summation_mode user_summation = summation;
+      group_mode user_group_per_replication = group_per_replication;
+      sampling = SAMPLE_WITH_REPLACEMENT;
+      resample_size = 0;
+      summation = SUMMATION_NAIVE;
+      group_per_replication = GROUP_NEVER;
+      std::vector<size_t> candidates = tuning_candidates();
+      const char* variants[] = { "gather", "vec4" };
+      const size_t nr_variants = sizeof(variants) / sizeof(variants[0]);
+      const int input_sizes[] = { 1000, 20000 };
+      std::vector<double> total_time(nr_variants * candidates.size(), 0.0);
+      
+      try {
+        for (size_t s = 0; s < sizeof(input_sizes) / sizeof(int); s++) {
+          std::vector<T> x(input_sizes[s]);
+          for (size_t i = 0; i < x.size(); i++) {
+            x[i] = (T) (i % 997);
+          }
+          call_profile profile;
+          device_input input = {};
+          input.kind = INPUT_VALUES;
+          input.nr_values = x.size();
+          input.draws = x.size();
+          input.values = create_input_buffer(x.size() * sizeof(T), &x[0], &profile, "values");
+          try {
+            for (size_t v = 0; v < nr_variants; v++) {
+              set_kernel_variant(variants[v]);
+              for (size_t c = 0; c < candidates.size(); c++) {
+                set_local_item_size(candidates[c]);
+                total_time[v * candidates.size() + c] += time_bootstrap_kernel(input);
+              }
+            }
+          } catch (...) {
+            release_input(input);
+            throw;
+          }
+          release_input(input);
+        }
+      } catch (...) {
+        sampling = user_sampling;
+        resample_size = user_resample_size;
+        vec4_variant = user_vec4_variant;
+        set_local_item_size(user_local_item_size);
+        summation = user_summation;
+        group_per_replication = user_group_per_replication;
+        throw;
+      }
+      sampling = user_sampling;
+      resample_size = user_resample_size;
+      summation = user_summation;
+      group_per_replication = user_group_per_replication;
+      
+      size_t best = std::min_element(total_time.begin(), total_time.end()) - total_time.begin();
+      tuning_entry entry;
+      entry.local_item_size = candidates[best % candidates.size()];
+      entry.variant = variants[best / candidates.size()];
+      set_local_item_size(entry.local_item_size);
+      set_kernel_variant(entry.variant);
+      store_tuning(tuning_device_key(device_id), entry);
+      return entry.local_item_size;
+    }
+    
+    std::vector<unsigned int> test_rand_gen_device(int n = 10) {
+      cl_int err;
+      const size_t cl_n = n;
+      std::vector<unsigned int> output(n);
+      cl_kernel gen_random_kernel_int = clCreateKernel(program, "gen_random_kernel_int", &err);
+      cl_mem buffer_output_test = clCreateBuffer(context, CL_MEM_READ_WRITE, n * sizeof(unsigned int), NULL, &err);
+      
+      CHECK_CL_ERROR(clSetKernelArg(gen_random_kernel_int, 0, sizeof(cl_mem), (void *)&buffer_rand_states));
+      CHECK_CL_ERROR(clSetKernelArg(gen_random_kernel_int, 1, sizeof(cl_mem), (void *)&buffer_output_test));
+      CHECK_CL_ERROR(clSetKernelArg(gen_random_kernel_int, 2, sizeof(int), (void *)&n));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, gen_random_kernel_int, 1, NULL, &cl_n, &cl_n, 0, NULL, NULL));
+
+      CHECK_CL_ERROR(clEnqueueReadBuffer(command_queue, buffer_output_test, CL_TRUE, 0, n * sizeof(unsigned int), &output[0], 0, NULL, NULL));
+      return(output);
+    }
+    
+  private:
+    
+    int replications = 0;
+    cl_device_id device_id;
+    int seed;
+    int sequence_offset = 0;
+    size_t global_item_size;
+    size_t local_item_size;
+    int resample_size;
+    sampling_mode sampling;
+    compression_mode compression;
+    bool deterministic = false;
+    summation_mode summation = SUMMATION_NAIVE;
+    // the plain bootstrap runs as bootstrap_vec4_kernel instead of bootstrap_kernel
+    bool vec4_variant = false;
+    group_mode group_per_replication = GROUP_AUTO;
+    input_encoding encoding = ENCODING_FLOAT;
+    cl_uint compute_units = 1;
+    // auto switches to a work group per replication while one item per replication fills less than
+    // group_waves work groups per compute unit and every item of a group still gets group_min_draws draws
+    const size_t group_waves = 4;
+    const int group_min_draws = 64;
+    // the summary kernels run at most max_summary_groups groups of up to summary_local_size items,
+    // which keeps their local memory at 8 KB and the partials read back at 1280 bytes
+    const size_t summary_local_size = 256;
+    const cl_uint max_summary_groups = 32;
+    // auto compression only kicks in below max_categories distinct values and if
+    // a binomial draw per category is cheaper than the gathers it replaces
+    const size_t max_categories = 256;
+    const int category_draw_cost = 16;
+    kernel_source kernel_source_code;
+    cl_program program;
+    cl_context context;
+    cl_kernel init_xorwow_kernel;
+    cl_kernel jackknife_mean_kernel;
+    cl_kernel jackknife_var_kernel;
+    cl_command_queue command_queue = NULL;
+    cl_command_queue upload_queue = NULL;
+    cl_command_queue readback_queue = NULL;
+    cl_mem buffer_rand_states = NULL;
+    cl_mem buffer_jump_tables = NULL;
+    cl_mem buffer_skip_tables = NULL;
+    std::string state_directory = rand_state_directory();
+    bool profiling = false;
+    std::mutex profile_mutex;
+    std::vector<profile_record> last_profile;
+    profile_counters counters = profile_counters();
+    // bumped whenever the rand states are rebuilt, lanes of an older generation are rebound before use
+    int generation = 0;
+    std::mutex lanes_mutex;
+    std::vector<std::unique_ptr<execution_lane> > lanes;
+    std::vector<execution_lane*> idle_lanes;
+    std::mutex jobs_mutex;
+    std::map<int, std::unique_ptr<bootstrap_job<T> > > jobs;
+    int next_job_handle = 1;
+    
+    // holds a lane of the pool for the lifetime of one call
+    class lane_guard {
+      public:
+        lane_guard(opencl_bootstrap_manager* manager_) : manager(manager_), lane(manager_->acquire_lane()) {}
+        ~lane_guard() { manager->return_lane(lane); }
+        execution_lane* get() { return lane; }
+        execution_lane* operator->() { return lane; }
+      private:
+        opencl_bootstrap_manager* manager;
+        execution_lane* lane;
+    };
+    
+    
+    void init(int replications_, int seed_, int sequence_offset_) {
+      set_local_item_size(32);
+      set_resample_size(0);
+      set_sampling_mode("replacement");
+      set_compression("auto");
+      setup_device();
+      set_kernel_variant(preferred_vector_width() > 1 ? "vec4" : "gather");
+      apply_tuning();
+      setup_replications(replications_, seed_, sequence_offset_);
+    }
+    
+    // a broken or missing tuning database is not an error, the defaults are used instead
+    void apply_tuning() {
+      tuning_entry entry;
+      try {
+        if (load_tuning(tuning_device_key(device_id), &entry)) {
+          // an entry of another library version or edited by hand may not fit these kernels, then it is ignored
+          std::vector<size_t> candidates = tuning_candidates();
+          if (entry.local_item_size > 0 && std::find(candidates.begin(), candidates.end(), (size_t) entry.local_item_size) != candidates.end()) {
+            set_kernel_variant(entry.variant);
+            set_local_item_size(entry.local_item_size);
+          }
+        }
+      } catch (const bootstrap_error&) {
+      }
+    }
+    
+    cl_uint preferred_vector_width() {
+      cl_uint width = 1;
+      CHECK_CL_ERROR(clGetDeviceInfo(device_id, CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT, sizeof(cl_uint), &width, NULL));
+      return width;
+    }
+    
+    // asked of a kernel of its own, so that it also works before the lanes have rand states to bind to
+    size_t kernel_work_group_info(const char* name, cl_kernel_work_group_info param) {
+      cl_int err;
+      cl_kernel kernel = clCreateKernel(program, name, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      size_t value = 0;
+      err = clGetKernelWorkGroupInfo(kernel, device_id, param, sizeof(size_t), &value, NULL);
+      CHECK_CL_ERROR(clReleaseKernel(kernel));
+      CHECK_CL_ERROR(err);
+      return value;
+    }
+    
+    // work-group sizes the bootstrap kernel accepts on this device: powers of two and small multiples of the preferred multiple
+    std::vector<size_t> tuning_candidates() {
+      size_t max_size = kernel_work_group_info("bootstrap_kernel", CL_KERNEL_WORK_GROUP_SIZE);
+      max_size = std::min(max_size, kernel_work_group_info("bootstrap_vec4_kernel", CL_KERNEL_WORK_GROUP_SIZE));
+      max_size = std::min(max_size, kernel_work_group_info("group_bootstrap_kernel", CL_KERNEL_WORK_GROUP_SIZE));
+      size_t multiple = kernel_work_group_info("bootstrap_kernel", CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE);
+      
+      std::vector<size_t> candidates;
+      for (size_t size = std::min((size_t) 8, max_size); size <= max_size; size *= 2) {
+        candidates.push_back(size);
+      }
+      const size_t factors[] = { 1, 2, 3, 4, 6, 8 };
+      for (size_t f = 0; f < sizeof(factors) / sizeof(size_t); f++) {
+        if (multiple > 0 && multiple * factors[f] <= max_size) {
+          candidates.push_back(multiple * factors[f]);
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+      candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+      return candidates;
+    }
+    
+    // median kernel time of a few runs at the current local item size
+    double time_bootstrap_kernel(device_input& input) {
+      call_profile profile;
+      lane_guard lane(this);
+      std::vector<double> times;
+      for (int run = 0; run < 4; run++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        enqueue_bootstrap(lane.get(), input, lane->output, &profile);
+        CHECK_CL_ERROR(clFinish(lane->queue));
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        // the first run only warms up
+        if (run > 0) {
+          times.push_back(elapsed.count());
+        }
+      }
+      std::sort(times.begin(), times.end());
+      return times[times.size() / 2];
+    }
+    
+    void set_default_device_id() {
+      cl_platform_id platform_id = NULL;
+      cl_device_id default_device_id = NULL;
+      cl_uint num_devices;
+      cl_uint num_platforms;
+      CHECK_CL_ERROR(clGetPlatformIDs(1, &platform_id, &num_platforms));
+      CHECK_CL_ERROR(clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_GPU, 1, &default_device_id, &num_devices));
+      device_id = default_device_id;
+    }
+    
+    void set_kernel_source() {
+      kernel_source_code = get_kernel_source(kernel_source_path().c_str());
+    }
+    
+    void init_rand_states_device(call_profile* profile) {
+      cl_int err;
+      
+      buffer_rand_states = clCreateBuffer(context, CL_MEM_READ_WRITE, replications * sizeof(xorwow_state), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+
+      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 0, sizeof(cl_mem), (void *)&buffer_rand_states));
+      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 1, sizeof(int), (void *)&replications));
+      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 2, sizeof(int), (void *)&seed));
+      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 3, sizeof(int), (void *)&sequence_offset));
+
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, init_xorwow_kernel, 1, NULL, &global_item_size, &local_item_size, 0, NULL, profile->kernel_event(init_xorwow_kernel)));
+      
+    }
+
+    void upload_rand_states(const std::vector<xorwow_state>& states, call_profile* profile) {
+      cl_int err;
+      size_t size = states.size() * sizeof(xorwow_state);
+      buffer_rand_states = clCreateBuffer(context, CL_MEM_READ_WRITE, size, NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      CHECK_CL_ERROR(clEnqueueWriteBuffer(command_queue, buffer_rand_states, CL_TRUE, 0, size, &states[0], 0, NULL, profile->event("write", "rand_states", size)));
+    }
+
+    // reads the fresh states back for later managers, unless they would neither fit the in-memory cache nor go to disk
+    void snapshot_rand_states(const rand_state_key& key, call_profile* profile) {
+      size_t size = replications * sizeof(xorwow_state);
+      if (state_directory.empty() && size > RAND_STATE_CACHE_BYTES) {
+        return;
+      }
+      std::vector<xorwow_state> states(replications);
+      CHECK_CL_ERROR(clEnqueueReadBuffer(command_queue, buffer_rand_states, CL_TRUE, 0, size, &states[0], 0, NULL, profile->event("read", "rand_states", size)));
+      // a snapshot that cannot be written only costs the next run the skip-ahead
+      store_rand_states(key, state_directory, states);
+    }
+
+    // context, program, kernels and queues only depend on the device and are created once
+    void setup_device()
+    {
+      cl_int err;
+      
+      set_kernel_source();
+
+      context = clCreateContext(NULL, 1, &device_id, NULL, NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+
+      program = clCreateProgramWithSource(context, 1, (const char **)&kernel_source_code.str, (const size_t *)&kernel_source_code.size, &err);
+      free(kernel_source_code.str);
+      kernel_source_code.str = NULL;
+      CHECK_CL_ERROR_AFTER(err);
+
+      err = clBuildProgram(program, 1, &device_id, NULL, NULL, NULL);
+      CHECK_CL_PROGRAM_ERROR(err, program, device_id);
+      CHECK_CL_ERROR_AFTER(err);
+      
+      init_xorwow_kernel = clCreateKernel(program, "init_xorwow_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      // the skip-ahead tables are the same for every seed, they are uploaded once with the program
+      const std::vector<cl_uint>& jump_tables = xorwow_digit_tables();
+      buffer_jump_tables = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, jump_tables.size() * sizeof(cl_uint), (void *)&jump_tables[0], &err);
+      CHECK_CL_ERROR_AFTER(err);
+      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 4, sizeof(cl_mem), (void *)&buffer_jump_tables));
+      const std::vector<cl_uint>& skip_tables = xorwow_skip_tables();
+      buffer_skip_tables = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, skip_tables.size() * sizeof(cl_uint), (void *)&skip_tables[0], &err);
+      CHECK_CL_ERROR_AFTER(err);
+      CHECK_CL_ERROR(clGetDeviceInfo(device_id, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &compute_units, NULL));
+      
+      jackknife_mean_kernel = clCreateKernel(program, "jackknife_mean_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      jackknife_var_kernel = clCreateKernel(program, "jackknife_var_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      
+      create_queues();
+    }
+    
+    cl_command_queue_properties queue_properties() {
+      return profiling ? CL_QUEUE_PROFILING_ENABLE : 0;
+    }
+    
+    void create_queues() {
+      cl_int err;
+      command_queue = clCreateCommandQueue(context, device_id, queue_properties(), &err);
+      CHECK_CL_ERROR_AFTER(err);
+      upload_queue = clCreateCommandQueue(context, device_id, queue_properties(), &err);
+      CHECK_CL_ERROR_AFTER(err);
+      readback_queue = clCreateCommandQueue(context, device_id, queue_properties(), &err);
+      CHECK_CL_ERROR_AFTER(err);
+    }
+    
+    void release_queues() {
+      CHECK_CL_ERROR(clFinish(command_queue));
+      CHECK_CL_ERROR(clFinish(upload_queue));
+      CHECK_CL_ERROR(clFinish(readback_queue));
+      CHECK_CL_ERROR(clReleaseCommandQueue(command_queue));
+      CHECK_CL_ERROR(clReleaseCommandQueue(upload_queue));
+      CHECK_CL_ERROR(clReleaseCommandQueue(readback_queue));
+    }
+    
+    // the records of a finished call become the last profile and are added to the counters
+    void publish_profile(call_profile& profile) {
+      if (!profile.is_enabled()) {
+        return;
+      }
+      std::vector<profile_record> records = profile.read();
+      std::lock_guard<std::mutex> lock(profile_mutex);
+      add_to_counters(counters, records);
+      last_profile.swap(records);
+    }
+    
+    // replication i of this manager uses the xorwow subsequence sequence_offset_ + i
+    void setup_replications(int replications_, int seed_, int sequence_offset_)
+    {
+      for (size_t l = 0; l < lanes.size(); l++) {
+        CHECK_CL_ERROR(clFinish(lanes[l]->queue));
+      }
+      CHECK_CL_ERROR(clFinish(command_queue));
+      // the kernels never write the rand states back, so the same parameters keep the resident states
+      if (buffer_rand_states && replications_ == replications && seed_ == seed && sequence_offset_ == sequence_offset) {
+        return;
+      }
+      if (buffer_rand_states) {
+        CHECK_CL_ERROR(clReleaseMemObject(buffer_rand_states));
+        buffer_rand_states = NULL;
+      }
+      
+      replications = replications_;
+      seed = seed_;
+      sequence_offset = sequence_offset_;
+      global_item_size = global_size_for(replications);
+      
+      call_profile profile(profiling);
+      rand_state_key key = { seed, sequence_offset, replications };
+      std::vector<xorwow_state> states;
+      if (load_rand_states(key, state_directory, &states)) {
+        upload_rand_states(states, &profile);
+      } else {
+        init_rand_states_device(&profile);
+        snapshot_rand_states(key, &profile);
+      }
+      // the lanes run on other queues of the context
+      CHECK_CL_ERROR(clFinish(command_queue));
+      publish_profile(profile);
+      generation++;
+    }
+    
+    // a lane per concurrent caller: the pool only grows up to the largest number of simultaneous calls
+    execution_lane* acquire_lane() {
+      execution_lane* lane = NULL;
+      {
+        std::lock_guard<std::mutex> lock(lanes_mutex);
+        if (!idle_lanes.empty()) {
+          lane = idle_lanes.back();
+          idle_lanes.pop_back();
+        }
+      }
+      if (!lane) {
+        lane = create_lane();
+        std::lock_guard<std::mutex> lock(lanes_mutex);
+        lanes.push_back(std::unique_ptr<execution_lane>(lane));
+      }
+      if (lane->generation != generation) {
+        bind_lane(lane);
+      }
+      return lane;
+    }
+    
+    void return_lane(execution_lane* lane) {
+      std::lock_guard<std::mutex> lock(lanes_mutex);
+      idle_lanes.push_back(lane);
+    }
+    
+    // kernels of one program can be created any number of times, each copy keeps its own arguments
+    execution_lane* create_lane() {
+      cl_int err;
+      execution_lane* lane = new execution_lane();
+      lane->queue = clCreateCommandQueue(context, device_id, queue_properties(), &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->bootstrap_kernel = clCreateKernel(program, "bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->bootstrap_vec4_kernel = clCreateKernel(program, "bootstrap_vec4_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->summation_bootstrap_kernel = clCreateKernel(program, "summation_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->group_bootstrap_kernel = clCreateKernel(program, "group_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      CHECK_CL_ERROR(clSetKernelArg(lane->group_bootstrap_kernel, 6, sizeof(cl_mem), (void *)&buffer_skip_tables));
+      lane->encoded_bootstrap_kernel = clCreateKernel(program, "encoded_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->integer_bootstrap_kernel = clCreateKernel(program, "integer_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->subsample_kernel = clCreateKernel(program, "subsample_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->weighted_bootstrap_kernel = clCreateKernel(program, "weighted_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->multinomial_bootstrap_kernel = clCreateKernel(program, "multinomial_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->binomial_bootstrap_kernel = clCreateKernel(program, "binomial_bootstrap_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->summary_partial_kernel = clCreateKernel(program, "summary_partial_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->histogram_kernel = clCreateKernel(program, "histogram_kernel", &err);
+      CHECK_CL_ERROR_AFTER(err);
+      lane->output = NULL;
+      lane->generation = -1;
+      return lane;
+    }
+    
+    // points the lane at the current rand states and sizes its output buffer for the current replications
+    void bind_lane(execution_lane* lane) {
+      cl_int err;
+      if (lane->output) {
+        CHECK_CL_ERROR(clReleaseMemObject(lane->output));
+      }
+      lane->output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, replications * sizeof(T), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      
+      cl_kernel replication_kernels[] = { lane->bootstrap_kernel, lane->bootstrap_vec4_kernel, lane->summation_bootstrap_kernel, lane->group_bootstrap_kernel, lane->encoded_bootstrap_kernel, lane->integer_bootstrap_kernel, lane->subsample_kernel, lane->weighted_bootstrap_kernel, lane->multinomial_bootstrap_kernel, lane->binomial_bootstrap_kernel };
+      for (size_t k = 0; k < sizeof(replication_kernels) / sizeof(cl_kernel); k++) {
+        CHECK_CL_ERROR(clSetKernelArg(replication_kernels[k], 0, sizeof(cl_mem), (void *)&buffer_rand_states));
+        CHECK_CL_ERROR(clSetKernelArg(replication_kernels[k], 1, sizeof(int), (int *)&replications));
+      }
+      lane->generation = generation;
+    }
+    
+    void release_lanes() {
+      for (size_t l = 0; l < lanes.size(); l++) {
+        release_lane(lanes[l].get());
+      }
+      lanes.clear();
+      idle_lanes.clear();
+    }
+    
+    void release_lane(execution_lane* lane) {
+      CHECK_CL_ERROR(clFinish(lane->queue));
+      CHECK_CL_ERROR(clReleaseCommandQueue(lane->queue));
+      CHECK_CL_ERROR(clReleaseKernel(lane->bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->bootstrap_vec4_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->summation_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->group_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->encoded_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->integer_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->subsample_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->weighted_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->multinomial_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->binomial_bootstrap_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->summary_partial_kernel));
+      CHECK_CL_ERROR(clReleaseKernel(lane->histogram_kernel));
+      if (lane->output) {
+        CHECK_CL_ERROR(clReleaseMemObject(lane->output));
+      }
+    }
+    
+    // with profiling the copy is an explicit, blocking write on upload_queue, so that it shows up in the profile
+    cl_mem create_input_buffer(size_t size, const void* host_ptr, call_profile* profile, const char* name) {
+      cl_int err;
+      cl_mem buffer;
+      if (profile->is_enabled()) {
+        buffer = clCreateBuffer(context, CL_MEM_READ_ONLY, size, NULL, &err);
+        CHECK_CL_ERROR_AFTER(err);
+        CHECK_CL_ERROR(clEnqueueWriteBuffer(upload_queue, buffer, CL_TRUE, 0, size, host_ptr, 0, NULL, profile->event("write", name, size)));
+      } else {
+        buffer = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, size, (void *) host_ptr, &err);
+        CHECK_CL_ERROR_AFTER(err);
+      }
+      return buffer;
+    }
+    
+    device_input upload_values(T* values, int nr_values, call_profile* profile) {
+      device_input input = {};
+      if (try_compress(values, nr_values, &input, profile)) {
+        return input;
+      }
+      
+      input.kind = INPUT_VALUES;
+      input.nr_values = nr_values;
+      input.draws = nr_values;
+      input.max_abs = (summation == SUMMATION_FIXED_POINT) ? max_abs_value(values, nr_values) : 0;
+      if (encoding != ENCODING_FLOAT) {
+        encoded_values encoded;
+        encode_values(values, nr_values, encoding, &encoded);
+        set_encoding(&input, encoded);
+        input.values = create_input_buffer(encoded.bytes.size(), &encoded.bytes[0], profile, "values");
+        return input;
+      }
+      input.values = create_input_buffer(nr_values * sizeof(T), values, profile, "values");
+      return input;
+    }
+    
+    // never compressed, the multinomial kernel would sum the categories in float
+    device_input upload_integers(const int* values, int nr_values, call_profile* profile) {
+      device_input input = {};
+      encoded_integers encoded;
+      encode_integers(values, nr_values, &encoded);
+      input.kind = INPUT_INTEGERS;
+      input.nr_values = nr_values;
+      input.draws = nr_values;
+      input.value_bytes = encoded.value_bytes;
+      input.integer_offset = encoded.offset;
+      input.values = create_input_buffer(encoded.bytes.size(), &encoded.bytes[0], profile, "values");
+      return input;
+    }
+    
+    void set_encoding(device_input* input, const encoded_values& encoded) {
+      input->encoding = encoded.encoding;
+      input->scale = encoded.scale;
+      input->offset = encoded.offset;
+    }
+    
+    // the alias table is built once per upload, afterwards every draw costs one column pick and one coin flip
+    device_input upload_weighted(T* values, const double* weights, int nr_values, bool frequency_weights, call_profile* profile) {
+      double total = 0;
+      for (int i = 0; i < nr_values; i++) {
+        if (!(weights[i] >= 0) || std::isinf(weights[i])) {
+          throw bootstrap_error("weights must be finite and >= 0");
+        }
+        if (frequency_weights && weights[i] != floor(weights[i])) {
+          throw bootstrap_error("frequency weights must be whole numbers");
+        }
+        total += weights[i];
+      }
+      if (!(total > 0)) {
+        throw bootstrap_error("at least one weight must be > 0");
+      }
+      if (frequency_weights && total > INT_MAX) {
+        throw bootstrap_error("the sum of the frequency weights must fit into an integer");
+      }
+      
+      std::vector<float> alias_prob(nr_values);
+      std::vector<int> alias_index(nr_values);
+      build_alias_table(weights, total, nr_values, &alias_prob[0], &alias_index[0]);
+      
+      device_input input = {};
+      input.kind = INPUT_WEIGHTED;
+      input.nr_values = nr_values;
+      input.draws = frequency_weights ? (int) total : nr_values;
+      input.values = create_input_buffer(nr_values * sizeof(T), values, profile, "values");
+      input.alias_prob = create_input_buffer(nr_values * sizeof(float), &alias_prob[0], profile, "alias_prob");
+      input.alias_index = create_input_buffer(nr_values * sizeof(int), &alias_index[0], profile, "alias_index");
+      return input;
+    }
+    
+    // false if the input should be uploaded as it is
+    bool try_compress(T* values, int nr_values, device_input* input, call_profile* profile) {
+      if (deterministic || summation != SUMMATION_NAIVE || compression == COMPRESS_NEVER || sampling != SAMPLE_WITH_REPLACEMENT) {
+        return false;
+      }
+      int successes = 0;
+      if (count_binary_successes(values, nr_values, &successes)) {
+        *input = device_input();
+        input->kind = INPUT_BINARY;
+        input->nr_values = nr_values;
+        input->successes = successes;
+        input->draws = nr_values;
+        return true;
+      }
+      size_t limit = (compression == COMPRESS_ALWAYS) ? (size_t) nr_values : max_categories;
+      std::vector<T> category_values;
+      std::vector<int> category_counts;
+      if (collapse_categories(values, nr_values, limit, category_values, category_counts)) {
+        int m = (resample_size > 0) ? resample_size : nr_values;
+        if (compression == COMPRESS_ALWAYS || (int) category_values.size() * category_draw_cost < m) {
+          *input = upload_categories(category_values, category_counts, nr_values, profile);
+          return true;
+        }
+      }
+      return false;
+    }
+    
+    // values are ordered by decreasing count, so the binomial chain usually runs out of draws early
+    device_input upload_categories(const std::vector<T>& category_values, const std::vector<int>& category_counts, int nr_values, call_profile* profile) {
+      int k = category_values.size();
+      std::vector<int> order(k);
+      for (int c = 0; c < k; c++) {
+        order[c] = c;
+      }
+      std::sort(order.begin(), order.end(), [&](int a, int b) { return category_counts[a] > category_counts[b]; });
+      
+      std::vector<T> sorted_values(k);
+      std::vector<double> conditional_probs(k);
+      long long remaining = nr_values;
+      for (int c = 0; c < k; c++) {
+        sorted_values[c] = category_values[order[c]];
+        conditional_probs[c] = (double) category_counts[order[c]] / (double) remaining;
+        remaining -= category_counts[order[c]];
+      }
+      
+      device_input input = {};
+      input.kind = INPUT_CATEGORIES;
+      input.nr_values = nr_values;
+      input.nr_categories = k;
+      input.draws = nr_values;
+      input.values = create_input_buffer(k * sizeof(T), &sorted_values[0], profile, "category_values");
+      input.conditional_probs = create_input_buffer(k * sizeof(double), &conditional_probs[0], profile, "conditional_probs");
+      return input;
+    }
+    
+    // false at the first value that is neither 0 nor 1
+    bool count_binary_successes(const T* values, int nr_values, int* successes) {
+      int count = 0;
+      for (int i = 0; i < nr_values; i++) {
+        if (values[i] == 1) {
+          count++;
+        } else if (values[i] != 0) {
+          return false;
+        }
+      }
+      *successes = count;
+      return nr_values > 0;
+    }
+    
+    // false as soon as there are more than max_distinct distinct values
+    bool collapse_categories(const T* values, int nr_values, size_t max_distinct, std::vector<T>& category_values, std::vector<int>& category_counts) {
+      std::unordered_map<T, int> index;
+      for (int i = 0; i < nr_values; i++) {
+        typename std::unordered_map<T, int>::iterator it = index.find(values[i]);
+        if (it != index.end()) {
+          category_counts[it->second]++;
+          continue;
+        }
+        if (index.size() >= max_distinct) {
+          return false;
+        }
+        index[values[i]] = category_values.size();
+        category_values.push_back(values[i]);
+        category_counts.push_back(1);
+      }
+      return !category_values.empty();
+    }
+    
+    void release_input(device_input& input) {
+      if (input.values) {
+        CHECK_CL_ERROR(clReleaseMemObject(input.values));
+      }
+      if (input.alias_prob) {
+        CHECK_CL_ERROR(clReleaseMemObject(input.alias_prob));
+      }
+      if (input.alias_index) {
+        CHECK_CL_ERROR(clReleaseMemObject(input.alias_index));
+      }
+      if (input.conditional_probs) {
+        CHECK_CL_ERROR(clReleaseMemObject(input.conditional_probs));
+      }
+    }
+    
+    int resample_size_for(const device_input& input) {
+      int m = (resample_size > 0) ? resample_size : input.draws;
+      if (sampling == SAMPLE_WITHOUT_REPLACEMENT && m > input.nr_values) {
+        throw bootstrap_error("subsampling needs a resample size <= the number of values");
+      }
+      return m;
+    }
+    
+    // below a few waves of work items the device idles, a group per replication pays off once its items have
+    // enough draws each to amortise their skip-ahead
+    bool use_group_kernel(int count, int m) {
+      if (deterministic || group_per_replication == GROUP_NEVER) {
+        return false;
+      }
+      if (group_per_replication == GROUP_ALWAYS) {
+        return true;
+      }
+      size_t device_items = (size_t) compute_units * group_waves * local_item_size;
+      return (size_t) count < device_items && (size_t) m >= group_min_draws * local_item_size;
+    }
+    
+    // picks the kernel for count replications and the kind of input and sets every argument after the output buffer
+    cl_kernel prepare_bootstrap_kernel(execution_lane* lane, const device_input& input, int count) {
+      int m = resample_size_for(input);
+      if (input.kind != INPUT_VALUES && input.kind != INPUT_INTEGERS && sampling == SAMPLE_WITHOUT_REPLACEMENT) {
+        throw bootstrap_error("subsampling is only supported for uncompressed, unweighted input");
+      }
+      
+      cl_kernel kernel;
+      switch (input.kind) {
+      case INPUT_BINARY:
+        kernel = lane->binomial_bootstrap_kernel;
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 3, sizeof(int), (void *)&input.successes));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 4, sizeof(int), (void *)&input.nr_values));
+        break;
+      case INPUT_INTEGERS: {
+        kernel = lane->integer_bootstrap_kernel;
+        int subsample = (sampling == SAMPLE_WITHOUT_REPLACEMENT);
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 3, sizeof(cl_mem), (void *)&input.values));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 4, sizeof(int), (void *)&input.nr_values));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 6, sizeof(int), (void *)&subsample));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 7, sizeof(int), (void *)&input.value_bytes));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 8, sizeof(cl_long), (void *)&input.integer_offset));
+        break;
+      }
+      case INPUT_CATEGORIES:
+        kernel = lane->multinomial_bootstrap_kernel;
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 3, sizeof(cl_mem), (void *)&input.values));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 4, sizeof(int), (void *)&input.nr_categories));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 6, sizeof(cl_mem), (void *)&input.conditional_probs));
+        break;
+      case INPUT_WEIGHTED:
+        kernel = lane->weighted_bootstrap_kernel;
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 3, sizeof(cl_mem), (void *)&input.values));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 4, sizeof(int), (void *)&input.nr_values));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 6, sizeof(cl_mem), (void *)&input.alias_prob));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 7, sizeof(cl_mem), (void *)&input.alias_index));
+        break;
+      default:
+        if (input.encoding != ENCODING_FLOAT) {
+          if (summation != SUMMATION_NAIVE) {
+            throw bootstrap_error("compact input encodings only support the 'naive' summation");
+          }
+          kernel = lane->encoded_bootstrap_kernel;
+          int subsample = (sampling == SAMPLE_WITHOUT_REPLACEMENT);
+          int encoding_id = input.encoding;
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 6, sizeof(int), (void *)&subsample));
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 7, sizeof(int), (void *)&encoding_id));
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 8, sizeof(float), (void *)&input.scale));
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 9, sizeof(float), (void *)&input.offset));
+        } else if (summation != SUMMATION_NAIVE) {
+          kernel = lane->summation_bootstrap_kernel;
+          int subsample = (sampling == SAMPLE_WITHOUT_REPLACEMENT);
+          int mode = summation;
+          int bits = host_fixed_point_bits(input.max_abs, m);
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 6, sizeof(int), (void *)&subsample));
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 7, sizeof(int), (void *)&mode));
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 8, sizeof(int), (void *)&bits));
+        } else if (sampling == SAMPLE_WITHOUT_REPLACEMENT) {
+          kernel = lane->subsample_kernel;
+        } else if (use_group_kernel(count, m)) {
+          kernel = lane->group_bootstrap_kernel;
+          CHECK_CL_ERROR(clSetKernelArg(kernel, 7, local_item_size * sizeof(T), NULL));
+        } else {
+          kernel = vec4_variant ? lane->bootstrap_vec4_kernel : lane->bootstrap_kernel;
+        }
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 3, sizeof(cl_mem), (void *)&input.values));
+        CHECK_CL_ERROR(clSetKernelArg(kernel, 4, sizeof(int), (void *)&input.nr_values));
+        break;
+      }
+      CHECK_CL_ERROR(clSetKernelArg(kernel, 5, sizeof(int), (void *)&m));
+      return kernel;
+    }
+    
+    void enqueue_bootstrap(execution_lane* lane, const device_input& input, cl_mem output, call_profile* profile, cl_uint nr_wait_events = 0, const cl_event* wait_events = NULL, cl_event* event = NULL) {
+      cl_kernel kernel = prepare_bootstrap_kernel(lane, input, replications);
+      size_t global_size = replication_global_size(lane, kernel, replications);
+      CHECK_CL_ERROR(clSetKernelArg(kernel, 2, sizeof(cl_mem), (void *)&output));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(lane->queue, kernel, 1, NULL, &global_size, &local_item_size, nr_wait_events, wait_events, event ? event : profile->kernel_event(kernel)));
+      if (event) {
+        profile->track_kernel(kernel, *event);
+      }
+    }
+    
+    void run_bootstrap(execution_lane* lane, device_input& input, T* h_out, call_profile* profile) {
+      enqueue_bootstrap(lane, input, lane->output, profile);
+      CHECK_CL_ERROR(clEnqueueReadBuffer(lane->queue, lane->output, CL_TRUE, 0, replications * sizeof(T), h_out, 0, NULL, profile->event("read", "output", replications * sizeof(T))));
+      release_input(input);
+    }
+    
+    void calc_bootstrap_on_gpu(T* values, T* h_out, int nr_values, call_profile* profile) {
+      device_input input = upload_values(values, nr_values, profile);
+      lane_guard lane(this);
+      run_bootstrap(lane.get(), input, h_out, profile);
+    }
+    
+    void release_slot_events(pipeline_slot& slot) {
+      if (slot.kernel_event) {
+        CHECK_CL_ERROR(clReleaseEvent(slot.kernel_event));
+        slot.kernel_event = NULL;
+      }
+      if (slot.read_event) {
+        CHECK_CL_ERROR(clReleaseEvent(slot.read_event));
+        slot.read_event = NULL;
+      }
+    }
+    
+    static void CL_CALLBACK job_completed(cl_event, cl_int, void *user_data) {
+      completion_flag* flag = (completion_flag*) user_data;
+      (*flag)->store(true);
+      delete flag;
+    }
+    
+    bootstrap_job<T>* find_job(int handle) {
+      typename std::map<int, std::unique_ptr<bootstrap_job<T> > >::iterator it = jobs.find(handle);
+      if (it == jobs.end()) {
+        throw bootstrap_error("unknown or already collected job handle");
+      }
+      return it->second.get();
+    }
+    
+    void release_job(bootstrap_job<T>* job) {
+      release_input(job->input);
+      CHECK_CL_ERROR(clReleaseMemObject(job->output));
+      CHECK_CL_ERROR(clReleaseEvent(job->read_event));
+    }
+    
+    // Vose's alias method: column i keeps itself with probability alias_prob[i], otherwise it yields alias_index[i]
+    void build_alias_table(const double* weights, double total, int n, float* alias_prob, int* alias_index) {
+      std::vector<double> scaled(n);
+      std::vector<int> small;
+      std::vector<int> large;
+      for (int i = 0; i < n; i++) {
+        scaled[i] = weights[i] * n / total;
+        alias_index[i] = i;
+        if (scaled[i] < 1.0) {
+          small.push_back(i);
+        } else {
+          large.push_back(i);
+        }
+      }
+      while (!small.empty() && !large.empty()) {
+        int s = small.back();
+        small.pop_back();
+        int l = large.back();
+        alias_prob[s] = (float) scaled[s];
+        alias_index[s] = l;
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        if (scaled[l] < 1.0) {
+          large.pop_back();
+          small.push_back(l);
+        }
+      }
+      // whatever is left over is 1 up to rounding
+      for (size_t i = 0; i < large.size(); i++) {
+        alias_prob[large[i]] = 1.0f;
+      }
+      for (size_t i = 0; i < small.size(); i++) {
+        alias_prob[small[i]] = 1.0f;
+      }
+    }
+    
+    size_t global_size_for(int n) {
+      return (size_t) local_item_size * ceil( ((float) n) / ((float) local_item_size) );
+    }
+    
+    // the vec4 kernel covers four replications per work item, the group kernel one per work group
+    size_t replication_global_size(execution_lane* lane, cl_kernel kernel, int count) {
+      if (kernel == lane->group_bootstrap_kernel) {
+        return (size_t) count * local_item_size;
+      }
+      return global_size_for((kernel == lane->bootstrap_vec4_kernel) ? (count + 3) / 4 : count);
+    }
+    
+    // summary_partial_kernel and histogram_kernel over the means in the lane output. The histogram takes the range
+    // from the partials on the device, so the lane queue runs both without a round trip to the host.
+    void summarise_on_gpu(execution_lane* lane, int nr_bins, std::vector<double>* partials, std::vector<unsigned int>* counts, call_profile* profile) {
+      cl_int err;
+      size_t local_size = std::min(local_item_size, summary_local_size);
+      int nr_groups = (int) std::min((size_t) std::min(compute_units, max_summary_groups), (replications + local_size - 1) / local_size);
+      size_t global_size = nr_groups * local_size;
+      partials->resize(nr_groups * summary_moments);
+      counts->resize(nr_bins);
+      cl_uint zero = 0;
+      
+      cl_mem d_partials = clCreateBuffer(context, CL_MEM_READ_WRITE, partials->size() * sizeof(double), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      cl_mem d_histogram = clCreateBuffer(context, CL_MEM_READ_WRITE, nr_bins * sizeof(cl_uint), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      CHECK_CL_ERROR(clEnqueueFillBuffer(lane->queue, d_histogram, &zero, sizeof(cl_uint), 0, nr_bins * sizeof(cl_uint), 0, NULL, profile->event("write", "histogram", nr_bins * sizeof(cl_uint))));
+      
+      CHECK_CL_ERROR(clSetKernelArg(lane->summary_partial_kernel, 0, sizeof(cl_mem), (void *)&lane->output));
+      CHECK_CL_ERROR(clSetKernelArg(lane->summary_partial_kernel, 1, sizeof(int), (void *)&replications));
+      CHECK_CL_ERROR(clSetKernelArg(lane->summary_partial_kernel, 2, sizeof(cl_mem), (void *)&d_partials));
+      // sums, sums of squares, minima and maxima of the items
+      CHECK_CL_ERROR(clSetKernelArg(lane->summary_partial_kernel, 3, 4 * local_size * sizeof(cl_double), NULL));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(lane->queue, lane->summary_partial_kernel, 1, NULL, &global_size, &local_size, 0, NULL, profile->kernel_event(lane->summary_partial_kernel)));
+      
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 0, sizeof(cl_mem), (void *)&lane->output));
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 1, sizeof(int), (void *)&replications));
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 2, sizeof(cl_mem), (void *)&d_partials));
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 3, sizeof(int), (void *)&nr_groups));
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 4, sizeof(int), (void *)&nr_bins));
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 5, sizeof(cl_mem), (void *)&d_histogram));
+      CHECK_CL_ERROR(clSetKernelArg(lane->histogram_kernel, 6, nr_bins * sizeof(cl_uint), NULL));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(lane->queue, lane->histogram_kernel, 1, NULL, &global_size, &local_size, 0, NULL, profile->kernel_event(lane->histogram_kernel)));
+      
+      CHECK_CL_ERROR(clEnqueueReadBuffer(lane->queue, d_partials, CL_FALSE, 0, partials->size() * sizeof(double), &(*partials)[0], 0, NULL, profile->event("read", "summary", partials->size() * sizeof(double))));
+      CHECK_CL_ERROR(clEnqueueReadBuffer(lane->queue, d_histogram, CL_TRUE, 0, nr_bins * sizeof(cl_uint), &(*counts)[0], 0, NULL, profile->event("read", "histogram", nr_bins * sizeof(cl_uint))));
+      
+      CHECK_CL_ERROR(clReleaseMemObject(d_partials));
+      CHECK_CL_ERROR(clReleaseMemObject(d_histogram));
+    }
+    
+    // the leave-one-out sum is the total minus value i, the total is summed here in double since the values are on the host anyway
+    void calc_jackknife_mean_on_gpu(T* values, T* h_out, int nr_values, call_profile* profile) {
+      
+      cl_int err;
+      size_t global_size = global_size_for(nr_values);
+      double total = 0;
+      for (int i = 0; i < nr_values; i++) {
+        total += values[i];
+      }
+      
+      cl_mem d_values = create_input_buffer(nr_values * sizeof(T), values, profile, "values");
+      cl_mem d_output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, nr_values * sizeof(T), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_mean_kernel, 0, sizeof(cl_mem), (void *)&d_values));
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_mean_kernel, 1, sizeof(int), (void *)&nr_values));
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_mean_kernel, 2, sizeof(double), (void *)&total));
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_mean_kernel, 3, sizeof(cl_mem), (void *)&d_output));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, jackknife_mean_kernel, 1, NULL, &global_size, &local_item_size, 0, NULL, profile->kernel_event(jackknife_mean_kernel)));
+      CHECK_CL_ERROR(clEnqueueReadBuffer(command_queue, d_output, CL_TRUE, 0, nr_values * sizeof(T), h_out, 0, NULL, profile->event("read", "output", nr_values * sizeof(T))));
+      
+      CHECK_CL_ERROR(clReleaseMemObject(d_values));
+      CHECK_CL_ERROR(clReleaseMemObject(d_output));
+    }
+    
+    void calc_jackknife_var_on_gpu(T* values, T* h_out, int nr_values, call_profile* profile) {
+      
+      cl_int err;
+      size_t global_size = global_size_for(nr_values);
+      
+      cl_mem d_values = create_input_buffer(nr_values * sizeof(T), values, profile, "values");
+      cl_mem d_output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, nr_values * sizeof(T), NULL, &err);
+      CHECK_CL_ERROR_AFTER(err);
+      
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_var_kernel, 0, sizeof(cl_mem), (void *)&d_values));
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_var_kernel, 1, sizeof(int), (void *)&nr_values));
+      CHECK_CL_ERROR(clSetKernelArg(jackknife_var_kernel, 2, sizeof(cl_mem), (void *)&d_output));
+      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, jackknife_var_kernel, 1, NULL, &global_size, &local_item_size, 0, NULL, profile->kernel_event(jackknife_var_kernel)));
+      CHECK_CL_ERROR(clEnqueueReadBuffer(command_queue, d_output, CL_TRUE, 0, nr_values * sizeof(T), h_out, 0, NULL, profile->event("read", "output", nr_values * sizeof(T))));
+      
+      CHECK_CL_ERROR(clReleaseMemObject(d_values));
+      CHECK_CL_ERROR(clReleaseMemObject(d_output));
+    }
+    
+    // returns the BCa acceleration and the jackknife standard error
+    std::vector<T> jackknife_acceleration_and_se(const std::vector<T>& loo) {
+      double n = loo.size();
+      double loo_mean = 0;
+      for (size_t i = 0; i < loo.size(); i++) {
+        loo_mean += loo[i];
+      }
+      loo_mean /= n;
+      
+      double sum_sq = 0;
+      double sum_cube = 0;
+      for (size_t i = 0; i < loo.size(); i++) {
+        double d = loo_mean - loo[i];
+        sum_sq += d * d;
+        sum_cube += d * d * d;
+      }
+      
+      std::vector<T> out(2);
+      out[0] = (sum_sq > 0) ? (T) (sum_cube / (6.0 * pow(sum_sq, 1.5))) : 0;
+      out[1] = (T) sqrt((n - 1) / n * sum_sq);
+      return(out);
+    }
+};
+
+
+// splits the replications into one contiguous shard per device. Shard d starts at xorwow subsequence
+// offset_d, so the means are the same as from a single device with the same seed.
+template <typename T>
+class opencl_multi_device_bootstrap_manager {
+  
+  public:
+    
+    opencl_multi_device_bootstrap_manager(int replications_, int seed_, std::string device_type)
+    {
+      std::vector<cl_device_id> devices = get_opencl_devices(parse_device_type(device_type));
+      if (devices.empty()) {
+        throw bootstrap_error("no OpenCL device of type '" + device_type + "' found");
+      }
+      
+      int calibration_replications = std::max(1, std::min(replications_, 4096));
+      for (size_t d = 0; d < devices.size(); d++) {
+        shards.push_back(new opencl_bootstrap_manager<T>(calibration_replications, seed_, devices[d], 0));
+        shards[d]->set_group_per_replication("never");
+      }
+      measure_throughput();
+      set_parameters(replications_, seed_);
+    }
+    
+    void set_parameters(int replications_, int seed_) {
+      replications = replications_;
+      seed = seed_;
+      shard_sizes = split_replications(replications);
+      int offset = 0;
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_shard(std::max(1, shard_sizes[d]), seed, offset);
+        offset += shard_sizes[d];
+      }
+    }
+    
+    void set_local_item_size(int item_size) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_local_item_size(item_size);
+      }
+    }
+    
+    void set_resample_size(int resample_size_) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_resample_size(resample_size_);
+      }
+    }
+    
+    void set_sampling_mode(std::string mode) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_sampling_mode(mode);
+      }
+    }
+    
+    void set_compression(std::string mode) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_compression(mode);
+      }
+    }
+
+    void set_deterministic(bool enabled) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_deterministic(enabled);
+      }
+    }
+
+    void set_summation(std::string mode) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_summation(mode);
+      }
+    }
+    
+    // 'auto' would decide by the size of each shard, so shards of different devices would add in different orders
+    // and the means would depend on the split. It stays with one work item per replication, like 'never'.
+    void set_group_per_replication(std::string mode) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_group_per_replication(mode == "auto" ? "never" : mode);
+      }
+    }
+    
+    void set_input_encoding(std::string name) {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->set_input_encoding(name);
+      }
+    }
+    
+    std::vector<int> get_shard_sizes() {
+      return shard_sizes;
+    }
+    
+    std::vector<double> get_throughput() {
+      return throughput;
+    }
+    
+    // every device works on its shard at the same time, the results are gathered in shard order
+    std::vector<T> get_bootstrapped_means(std::vector<T> x) {
+      std::vector<int> handles(shards.size(), 0);
+      for (size_t d = 0; d < shards.size(); d++) {
+        if (shard_sizes[d] > 0) {
+          handles[d] = shards[d]->submit(x);
+        }
+      }
+      std::vector<T> h_out;
+      h_out.reserve(replications);
+      for (size_t d = 0; d < shards.size(); d++) {
+        if (shard_sizes[d] > 0) {
+          std::vector<T> shard_out = shards[d]->collect(handles[d]);
+          h_out.insert(h_out.end(), shard_out.begin(), shard_out.end());
+        }
+      }
+      return(h_out);
+    }
+    
+    ~opencl_multi_device_bootstrap_manager() {
+      
+    };
+    
+    void cleanup_device() {
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->cleanup_device();
+        delete shards[d];
+      }
+      shards.clear();
+    }
+    
+  private:
+    
+    int replications;
+    int seed;
+    std::vector<opencl_bootstrap_manager<T>*> shards;
+    std::vector<int> shard_sizes;
+    std::vector<double> throughput;
+    
+    // replications per second of every device on a fixed input, after one warm-up run
+    void measure_throughput() {
+      std::vector<T> x(16384);
+      for (size_t i = 0; i < x.size(); i++) {
+        x[i] = (T) i;
+      }
+      throughput.resize(shards.size());
+      for (size_t d = 0; d < shards.size(); d++) {
+        shards[d]->get_bootstrapped_means(x);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<T> out = shards[d]->get_bootstrapped_means(x);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        throughput[d] = out.size() / std::max(elapsed.count(), 1e-9);
+      }
+    }
+    
+    // proportional to throughput, the rounding remainder goes to the fastest device
+    std::vector<int> split_replications(int total) {
+      double total_throughput = 0;
+      size_t fastest = 0;
+      for (size_t d = 0; d < throughput.size(); d++) {
+        total_throughput += throughput[d];
+        if (throughput[d] > throughput[fastest]) {
+          fastest = d;
+        }
+      }
+      std::vector<int> sizes(throughput.size());
+      int assigned = 0;
+      for (size_t d = 0; d < throughput.size(); d++) {
+        sizes[d] = (int) floor(total * throughput[d] / total_throughput);
+        assigned += sizes[d];
+      }
+      sizes[fastest] += total - assigned;
+      return sizes;
+    }
+};
+
+
+// dynamic alternative to the static shards: the replications are cut into chunks and every device (plus
+// optional host threads) pulls the next chunk from a shared counter. Every device holds the rand states of
+// all replications and replication i always uses subsequence i, so the result does not depend on who computed it.
+template <typename T>
+class opencl_work_stealing_bootstrap_manager {
+  
+  public:
+    
+    opencl_work_stealing_bootstrap_manager(int replications_, int seed_, std::string device_type, int host_threads_)
+    {
+      replications = replications_;
+      seed = seed_;
+      host_threads = std::max(0, host_threads_);
+      resample_size = 0;
+      without_replacement = false;
+      if (device_type != "none") {
+        std::vector<cl_device_id> devices = get_opencl_devices(parse_device_type(device_type));
+        for (size_t d = 0; d < devices.size(); d++) {
+          workers.push_back(new opencl_bootstrap_manager<T>(replications, seed, devices[d], 0));
+          workers[d]->set_group_per_replication("never");
+        }
+      }
+      if (workers.empty() && host_threads == 0) {
+        throw bootstrap_error("neither an OpenCL device of type '" + device_type + "' nor host threads to work with");
+      }
+      set_chunk_size(0);
+    }
+    
+    void set_parameters(int replications_, int seed_) {
+      replications = replications_;
+      seed = seed_;
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_parameters(replications, seed);
+      }
+      set_chunk_size(requested_chunk_size);
+    }
+    
+    // 0 picks about 8 chunks per worker, but at least 1024 replications per chunk
+    void set_chunk_size(int chunk_size_) {
+      requested_chunk_size = std::max(0, chunk_size_);
+      if (requested_chunk_size > 0) {
+        chunk_size = requested_chunk_size;
+      } else {
+        int nr_workers = workers.size() + host_threads;
+        chunk_size = std::max(1024, (int) ceil(replications / (8.0 * nr_workers)));
+      }
+    }
+    
+    void set_local_item_size(int item_size) {
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_local_item_size(item_size);
+      }
+    }
+    
+    void set_resample_size(int resample_size_) {
+      if (resample_size_ < 0) {
+        throw bootstrap_error("the resample size must be >= 0 (0 uses the length of the input)");
+      }
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_resample_size(resample_size_);
+      }
+      resample_size = resample_size_;
+    }
+    
+    void set_sampling_mode(std::string mode) {
+      if (mode != "replacement" && mode != "subsampling") {
+        throw bootstrap_error("unknown sampling mode '" + mode + "', use 'replacement' or 'subsampling'");
+      }
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_sampling_mode(mode);
+      }
+      without_replacement = (mode == "subsampling");
+    }
+    
+    void set_compression(std::string mode) {
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_compression(mode);
+      }
+    }
+
+    void set_deterministic(bool enabled) {
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_deterministic(enabled);
+      }
+    }
+
+    void set_summation(std::string mode) {
+      summation = parse_summation_mode(mode);
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_summation(mode);
+      }
+    }
+    
+    // 'auto' would decide per chunk, and the host threads never add in the order of the group kernel, so it stays
+    // with one work item per replication, like 'never'. 'always' leaves the chunks to the devices alone.
+    void set_group_per_replication(std::string mode) {
+      if (mode != "auto" && mode != "always" && mode != "never") {
+        throw bootstrap_error("unknown group mode '" + mode + "', use 'auto', 'always' or 'never'");
+      }
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_group_per_replication(mode == "auto" ? "never" : mode);
+      }
+      group_always = (mode == "always");
+    }
+    
+    void set_input_encoding(std::string name) {
+      encoding = parse_input_encoding(name);
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->set_input_encoding(name);
+      }
+    }
+    
+    // chunks computed by every device and then every host thread in the last run
+    std::vector<int> get_chunks_per_worker() {
+      return chunks_per_worker;
+    }
+    
+    std::vector<T> get_bootstrapped_means(std::vector<T> x) {
+      if (x.empty()) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      int nr_values = x.size();
+      std::vector<T> h_out(replications);
+      std::vector<device_input> inputs(workers.size());
+      for (size_t d = 0; d < workers.size(); d++) {
+        inputs[d] = workers[d]->upload(x);
+      }
+      
+      // the host threads only replicate the plain gather kernels, compressed inputs and the group kernel stay on the devices
+      int m = (resample_size > 0) ? resample_size : nr_values;
+      bool host_helps = host_threads > 0 && (workers.empty() || (inputs[0].kind == INPUT_VALUES && !group_always));
+      if (without_replacement && m > nr_values) {
+        throw bootstrap_error("subsampling needs a resample size <= the number of values");
+      }
+      if (workers.empty() && !host_helps) {
+        throw bootstrap_error("no worker can process this input");
+      }
+      int fixed_point_bits = (summation == SUMMATION_FIXED_POINT) ? host_fixed_point_bits(max_abs_value(&x[0], nr_values), m) : 0;
+      encoded_values encoded;
+      if (host_helps && encoding != ENCODING_FLOAT) {
+        encode_values(&x[0], nr_values, encoding, &encoded);
+      }
+      
+      int nr_chunks = (replications + chunk_size - 1) / chunk_size;
+      std::atomic<int> next_chunk(0);
+      int nr_threads = workers.size() + (host_helps ? host_threads : 0);
+      chunks_per_worker.assign(workers.size() + host_threads, 0);
+      std::vector<std::exception_ptr> errors(nr_threads);
+      std::vector<std::thread> threads;
+      
+      for (int w = 0; w < nr_threads; w++) {
+        threads.push_back(std::thread([&, w]() {
+          try {
+            int chunk;
+            while ((chunk = next_chunk.fetch_add(1)) < nr_chunks) {
+              int first = chunk * chunk_size;
+              int count = std::min(chunk_size, replications - first);
+              if (w < (int) workers.size()) {
+                workers[w]->calc_bootstrap_range(inputs[w], first, count, &h_out[first]);
+              } else {
+                if (encoding != ENCODING_FLOAT) {
+                  host_encoded_chunk(encoded, nr_values, m, first, count, &h_out[first]);
+                } else {
+                  host_chunk(&x[0], nr_values, m, fixed_point_bits, first, count, &h_out[first]);
+                }
+              }
+              chunks_per_worker[w]++;
+            }
+          } catch (...) {
+            errors[w] = std::current_exception();
+            next_chunk.store(nr_chunks);
+          }
+        }));
+      }
+      for (size_t t = 0; t < threads.size(); t++) {
+        threads[t].join();
+      }
+      
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->release(inputs[d]);
+      }
+      for (size_t t = 0; t < errors.size(); t++) {
+        if (errors[t]) {
+          std::rethrow_exception(errors[t]);
+        }
+      }
+      return(h_out);
+    }
+    
+    ~opencl_work_stealing_bootstrap_manager() {
+      
+    };
+    
+    void cleanup_device() {
+      for (size_t d = 0; d < workers.size(); d++) {
+        workers[d]->cleanup_device();
+        delete workers[d];
+      }
+      workers.clear();
+    }
+    
+  private:
+    
+    int replications;
+    int seed;
+    int host_threads;
+    int chunk_size;
+    int requested_chunk_size;
+    int resample_size;
+    bool without_replacement;
+    bool group_always = false;
+    summation_mode summation = SUMMATION_NAIVE;
+    input_encoding encoding = ENCODING_FLOAT;
+    std::vector<opencl_bootstrap_manager<T>*> workers;
+    std::vector<int> chunks_per_worker;
+    
+    // a chunk of a host thread, naive draws with replacement go through the vectorised path of host_simd.h
+    void host_chunk(const T* values, int nr_values, int m, int fixed_point_bits, int first, int count, T* output) {
+      std::vector<xorwow_state> states(count);
+      host_init_rand_states(seed, first, count, &states[0]);
+      if (without_replacement || summation != SUMMATION_NAIVE) {
+        for (int i = 0; i < count; i++) {
+          output[i] = host_bootstrap_replication(states[i], values, nr_values, m, without_replacement, summation, fixed_point_bits);
+        }
+        return;
+      }
+      host_bootstrap_states(&states[0], count, values, nr_values, m, output);
+    }
+    
+    void host_encoded_chunk(const encoded_values& encoded, int nr_values, int m, int first, int count, T* output) {
+      std::vector<xorwow_state> states(count);
+      host_init_rand_states(seed, first, count, &states[0]);
+      host_encoded_bootstrap_states(&states[0], count, encoded, nr_values, m, without_replacement, output);
+    }
+};
+
+// The device kernels run on the host, one replication after the other, with the rand states init_xorwow_kernel
+// would produce. It needs no OpenCL device, so it is the fallback where there is none, and its output is the
+// bit-exact reference for opencl_bootstrap_manager in deterministic mode with the same seed and sequence offset.
+template <typename T>
+class cpu_bootstrap_manager {
+
+  public:
+
+    cpu_bootstrap_manager(int replications_, int seed_) : cpu_bootstrap_manager(replications_, seed_, 0) {}
+
+    cpu_bootstrap_manager(int replications_, int seed_, int sequence_offset_)
+    {
+      resample_size = 0;
+      without_replacement = false;
+      set_shard(replications_, seed_, sequence_offset_);
+    }
+
+    void set_parameters(int replications_, int seed_) {
+      set_shard(replications_, seed_, sequence_offset);
+    }
+
+    void set_shard(int replications_, int seed_, int sequence_offset_) {
+      replications = replications_;
+      seed = seed_;
+      sequence_offset = sequence_offset_;
+      rand_states.resize(std::max(0, replications));
+      host_init_rand_states(seed, sequence_offset, replications, rand_states.data());
+    }
+
+    void set_resample_size(int resample_size_) {
+      if (resample_size_ < 0) {
+        throw bootstrap_error("the resample size must be >= 0 (0 uses the length of the input)");
+      }
+      resample_size = resample_size_;
+    }
+
+    void set_sampling_mode(std::string mode) {
+      if (mode != "replacement" && mode != "subsampling") {
+        throw bootstrap_error("unknown sampling mode '" + mode + "', use 'replacement' or 'subsampling'");
+      }
+      without_replacement = (mode == "subsampling");
+    }
+
+    void set_summation(std::string mode) {
+      summation = parse_summation_mode(mode);
+    }
+
+    void set_input_encoding(std::string name) {
+      encoding = parse_input_encoding(name);
+    }
+
+    std::vector<T> get_bootstrapped_means(std::vector<T> x) {
+      int nr_values = x.size();
+      if (nr_values == 0) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      int m = (resample_size > 0) ? resample_size : nr_values;
+      if (without_replacement && m > nr_values) {
+        throw bootstrap_error("subsampling needs a resample size <= the number of values");
+      }
+      std::vector<T> h_out(replications);
+      if (encoding != ENCODING_FLOAT) {
+        if (summation != SUMMATION_NAIVE) {
+          throw bootstrap_error("compact input encodings only support the 'naive' summation");
+        }
+        encoded_values encoded;
+        encode_values(&x[0], nr_values, encoding, &encoded);
+        host_encoded_bootstrap_states(rand_states.data(), replications, encoded, nr_values, m, without_replacement, &h_out[0]);
+      } else if (without_replacement || summation != SUMMATION_NAIVE) {
+        int fixed_point_bits = (summation == SUMMATION_FIXED_POINT) ? host_fixed_point_bits(max_abs_value(&x[0], nr_values), m) : 0;
+        for (int i = 0; i < replications; i++) {
+          h_out[i] = host_bootstrap_replication(rand_states[i], &x[0], nr_values, m, without_replacement, summation, fixed_point_bits);
+        }
+      } else {
+        host_bootstrap_states(rand_states.data(), replications, &x[0], nr_values, m, &h_out[0]);
+      }
+      return h_out;
+    }
+
+    std::vector<T> get_bootstrapped_means_int(std::vector<int> x) {
+      int nr_values = x.size();
+      if (nr_values == 0) {
+        throw bootstrap_error("the input needs at least one value");
+      }
+      int m = (resample_size > 0) ? resample_size : nr_values;
+      if (without_replacement && m > nr_values) {
+        throw bootstrap_error("subsampling needs a resample size <= the number of values");
+      }
+      std::vector<T> h_out(replications);
+      encoded_integers encoded;
+      encode_integers(&x[0], nr_values, &encoded);
+      host_integer_bootstrap_states(rand_states.data(), replications, encoded, nr_values, m, without_replacement, &h_out[0]);
+      return h_out;
+    }
+
+    // summarises the means on the host like get_bootstrap_summary of the device, only the sums may differ in the last bits
+    bootstrap_summary get_bootstrap_summary(std::vector<T> x, int nr_bins, std::vector<double> probs) {
+      check_summary_arguments(nr_bins, probs);
+      std::vector<T> means = get_bootstrapped_means(x);
+      std::vector<double> partials;
+      std::vector<unsigned int> counts;
+      host_summary_partials(&means[0], replications, nr_bins, &partials, &counts);
+      return finish_summary(partials, counts, replications, probs);
+    }
+
+    // the first draw of each of the first n replications, like test_rand_gen_device
+    std::vector<unsigned int> test_rand_gen(int n = 10) {
+      std::vector<unsigned int> output(std::max(0, std::min(n, replications)));
+      for (size_t i = 0; i < output.size(); i++) {
+        xorwow_state state = rand_states[i];
+        output[i] = xorwow_next(&state);
+      }
+      return output;
+    }
+
+    const std::vector<xorwow_state>& get_rand_states() const {
+      return rand_states;
+    }
+
+  private:
+
+    int replications;
+    int seed;
+    int sequence_offset;
+    int resample_size;
+    bool without_replacement;
+    summation_mode summation = SUMMATION_NAIVE;
+    input_encoding encoding = ENCODING_FLOAT;
+    std::vector<xorwow_state> rand_states;
+};
+
+
+// the float managers are compiled once into the library (src/bootstrap_manager.cpp)
+extern template class opencl_bootstrap_manager<float>;
+extern template class opencl_multi_device_bootstrap_manager<float>;
+extern template class opencl_work_stealing_bootstrap_manager<float>;
+extern template class cpu_bootstrap_manager<float>;
+
+typedef opencl_bootstrap_manager<float> opencl_bootstrap_manager_float;
+typedef opencl_multi_device_bootstrap_manager<float> opencl_multi_device_bootstrap_manager_float;
+typedef opencl_work_stealing_bootstrap_manager<float> opencl_work_stealing_bootstrap_manager_float;
+typedef cpu_bootstrap_manager<float> cpu_bootstrap_manager_float;
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef BOOTSTRAP_SUMMARY_H
+#define BOOTSTRAP_SUMMARY_H
+
+#include <vector>
+
+// The bootstrap distribution reduced to a few numbers, for callers (dashboards) that need the standard error, some
+// quantiles or a histogram rather than one float per replication. summary_partial_kernel and histogram_kernel reduce
+// the means on the device, only their partials and the bin counts are read back.
+
+// doubles per partial of summary_partial_kernel: sum and sum of squares of mean - first mean, minimum, maximum and
+// the first mean. The shift keeps the variance from cancelling when the spread is small against the mean.
+const int summary_moments = 5;
+// the bins are counted in local memory, 4 bytes each
+const int max_histogram_bins = 4096;
+
+typedef struct t_bootstrap_summary {
+  int replications;
+  double mean;
+  // the standard deviation of the bootstrapped means
+  double se;
+  double min;
+  double max;
+  // nr_bins + 1 equally spaced edges from min to max, the last bin includes max
+  std::vector<double> breaks;
+  std::vector<unsigned int> counts;
+  // interpolated within their bin, so they are off by at most one bin width
+  std::vector<double> quantiles;
+} bootstrap_summary;
+
+// throws bootstrap_error for a bin count outside 1 .. max_histogram_bins or probabilities outside 0 .. 1
+void check_summary_arguments(int nr_bins, const std::vector<double>& probs);
+
+// summary_partial_kernel and histogram_kernel for means that are already on the host, as a single partial
+void host_summary_partials(const float *means, int count, int nr_bins, std::vector<double> *partials, std::vector<unsigned int> *counts);
+
+// combines the partials of the groups, count is the nr of means
+bootstrap_summary finish_summary(const std::vector<double>& partials, const std::vector<unsigned int>& counts, int count, const std::vector<double>& probs);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef HOST_SIMD_H
+#define HOST_SIMD_H
+
+#include <xorwow_host.h>
+
+// Vectorised bootstrap_kernel for the host: 8 (AVX2) or 16 (AVX-512) replications advance their xorwow states side
+// by side, draw their indices with a vector multiply-high and gather the values. The instruction set is picked at
+// run time, and every lane sums in the order of host_bootstrap_replication, so the means are the same bit for bit.
+
+// "avx512", "avx2" or "scalar"
+const char* host_simd_isa();
+
+// replications per step of the widest instruction set the CPU has
+int host_simd_width();
+
+// bootstrap_kernel for count replications from their rand states, the float overload of host_bootstrap_states
+void host_bootstrap_states(const xorwow_state *states, int count, const float *values, int nr_values, int resample_size, float *output);
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef INPUT_ENCODING_H
+#define INPUT_ENCODING_H
+
+#include <string>
+#include <vector>
+
+#include <xorwow_host.h>
+
+// Compact storage of the values on the device, random gathers then move 2 or 1 instead of 4 bytes per draw.
+// half and bfloat16 are widened to float by encoded_bootstrap_kernel, int8 and int16 hold the affine codes
+// value = offset + scale * code (code 0 .. 255 or 0 .. 65535), which the kernel sums exactly as integers.
+// An input is a single column, so it has one scale and offset.
+
+// the values are the ENCODING_* constants of kernels.cl
+enum input_encoding {
+  ENCODING_FLOAT = 0,
+  ENCODING_HALF = 1,
+  ENCODING_BFLOAT16 = 2,
+  ENCODING_INT8 = 3,
+  ENCODING_INT16 = 4
+};
+
+typedef struct t_encoded_values {
+  input_encoding encoding;
+  std::vector<unsigned char> bytes;
+  float scale;
+  float offset;
+} encoded_values;
+
+// integer input (counts) as unsigned value - offset in 1, 2 or 4 bytes, whichever holds the range
+typedef struct t_encoded_integers {
+  int value_bytes;
+  long long offset;
+  std::vector<unsigned char> bytes;
+} encoded_integers;
+
+typedef struct t_encoding_error {
+  std::string encoding;
+  int bytes_per_value;
+  // a mean of any resample is off by at most max_abs_error, plus the rounding of its float sum
+  double max_abs_error;
+  double max_rel_error;
+} encoding_error;
+
+// "float" (default), "half", "bf16", "int8" or "int16"
+input_encoding parse_input_encoding(const std::string& name);
+
+const char* input_encoding_name(input_encoding encoding);
+
+int encoded_value_bytes(input_encoding encoding);
+
+// throws bootstrap_error for an empty input and for values that are not finite or do not fit the encoding (beyond
+// +-65504 for half)
+void encode_values(const float *values, int nr_values, input_encoding encoding, encoded_values *encoded);
+
+// the value the kernel sees for entry i
+double decode_value(const encoded_values& encoded, int i);
+
+// what every encoding would make of these values, throws bootstrap_error for an empty input
+std::vector<encoding_error> encoding_errors(const float *values, int nr_values);
+
+void encode_integers(const int *values, int nr_values, encoded_integers *encoded);
+
+// integer_bootstrap_kernel for count replications from their rand states
+void host_integer_bootstrap_states(const xorwow_state *states, int count, const encoded_integers& encoded, int nr_values, int resample_size, bool without_replacement, float *output);
+
+// encoded_bootstrap_kernel for count replications from their rand states
+void host_encoded_bootstrap_states(const xorwow_state *states, int count, const encoded_values& encoded, int nr_values, int resample_size, bool without_replacement, float *output);
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef OPENCL_PROFILE_H
+#define OPENCL_PROFILE_H
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <opencl_utilities.h>
+
+// one write, kernel or read of a profiled call, the times are the device's CL_PROFILING_COMMAND_* values in ns
+typedef struct t_profile_record {
+  std::string stage;
+  std::string name;
+  size_t bytes;
+  cl_ulong queued;
+  cl_ulong submit;
+  cl_ulong start;
+  cl_ulong end;
+} profile_record;
+
+// summed over every profiled call since the counters were last reset
+typedef struct t_profile_counters {
+  unsigned long long calls;
+  unsigned long long writes;
+  unsigned long long kernels;
+  unsigned long long reads;
+  unsigned long long bytes_written;
+  unsigned long long bytes_read;
+  unsigned long long write_ns;
+  unsigned long long kernel_ns;
+  unsigned long long read_ns;
+} profile_counters;
+
+inline void add_to_counters(profile_counters& counters, const std::vector<profile_record>& records) {
+  counters.calls++;
+  for (size_t i = 0; i < records.size(); i++) {
+    const profile_record& r = records[i];
+    unsigned long long ns = r.end - r.start;
+    if (r.stage == "write") {
+      counters.writes++;
+      counters.bytes_written += r.bytes;
+      counters.write_ns += ns;
+    } else if (r.stage == "read") {
+      counters.reads++;
+      counters.bytes_read += r.bytes;
+      counters.read_ns += ns;
+    } else {
+      counters.kernels++;
+      counters.kernel_ns += ns;
+    }
+  }
+}
+
+// Collects the events of one call. With profiling off it hands out NULL events and records nothing,
+// so the enqueue calls stay the same either way.
+class call_profile {
+
+  public:
+
+    explicit call_profile(bool enabled_ = false) : enabled(enabled_) {}
+
+    ~call_profile() {
+      for (size_t i = 0; i < commands.size(); i++) {
+        if (commands[i].event) {
+          clReleaseEvent(commands[i].event);
+        }
+      }
+    }
+
+    void enable(bool enabled_) {
+      enabled = enabled_;
+    }
+
+    bool is_enabled() const {
+      return enabled;
+    }
+
+    // the event to pass to clEnqueue*
+    cl_event* event(const char* stage, const std::string& name, size_t bytes) {
+      if (!enabled) {
+        return NULL;
+      }
+      profiled_command command = { stage, name, bytes, NULL };
+      commands.push_back(command);
+      return &commands.back().event;
+    }
+
+    cl_event* kernel_event(cl_kernel kernel) {
+      return enabled ? event("kernel", kernel_name(kernel), 0) : NULL;
+    }
+
+    // an event the caller needs for itself, it is retained until the profile is read
+    void track(const char* stage, const std::string& name, size_t bytes, cl_event event_) {
+      if (!enabled || !event_) {
+        return;
+      }
+      CHECK_CL_ERROR(clRetainEvent(event_));
+      profiled_command command = { stage, name, bytes, event_ };
+      commands.push_back(command);
+    }
+
+    void track_kernel(cl_kernel kernel, cl_event event_) {
+      if (enabled) {
+        track("kernel", kernel_name(kernel), 0, event_);
+      }
+    }
+
+    // waits for every command, commands that were never enqueued are skipped
+    std::vector<profile_record> read() {
+      std::vector<profile_record> records;
+      for (size_t i = 0; i < commands.size(); i++) {
+        profiled_command& command = commands[i];
+        if (!command.event) {
+          continue;
+        }
+        profile_record record;
+        record.stage = command.stage;
+        record.name = command.name;
+        record.bytes = command.bytes;
+        CHECK_CL_ERROR(clWaitForEvents(1, &command.event));
+        CHECK_CL_ERROR(clGetEventProfilingInfo(command.event, CL_PROFILING_COMMAND_QUEUED, sizeof(cl_ulong), &record.queued, NULL));
+        CHECK_CL_ERROR(clGetEventProfilingInfo(command.event, CL_PROFILING_COMMAND_SUBMIT, sizeof(cl_ulong), &record.submit, NULL));
+        CHECK_CL_ERROR(clGetEventProfilingInfo(command.event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &record.start, NULL));
+        CHECK_CL_ERROR(clGetEventProfilingInfo(command.event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &record.end, NULL));
+        CHECK_CL_ERROR(clReleaseEvent(command.event));
+        command.event = NULL;
+        records.push_back(record);
+      }
+      commands.clear();
+      return records;
+    }
+
+  private:
+
+    typedef struct t_profiled_command {
+      std::string stage;
+      std::string name;
+      size_t bytes;
+      cl_event event;
+    } profiled_command;
+
+    bool enabled;
+    // a deque keeps the addresses handed out by event() valid while more commands are added
+    std::deque<profiled_command> commands;
+
+    call_profile(const call_profile&);
+    call_profile& operator=(const call_profile&);
+
+    static std::string kernel_name(cl_kernel kernel) {
+      size_t size = 0;
+      CHECK_CL_ERROR(clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, 0, NULL, &size));
+      std::string name(size, '\0');
+      CHECK_CL_ERROR(clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, size, &name[0], NULL));
+      return std::string(name.c_str());
+    }
+};
+
+#endif
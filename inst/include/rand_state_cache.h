@@ -0,0 +1,34 @@
+#ifndef RAND_STATE_CACHE_H
+#define RAND_STATE_CACHE_H
+
+#include <string>
+#include <vector>
+
+#include <xorwow_host.h>
+
+// Initialised rand states of a manager, keyed by everything init_xorwow_kernel depends on. The most recently
+// used snapshots of the process stay in memory, up to RAND_STATE_CACHE_BYTES. With a snapshot directory
+// (FASTBOOTSTRAP_STATE_CACHE, or set per manager) they are also written to disk for later processes.
+
+#define RAND_STATE_CACHE_BYTES (64 << 20)
+// bump whenever the seeding in init_xorwow_kernel changes, older snapshot files are then ignored
+#define RAND_STATE_FORMAT (1)
+
+typedef struct t_rand_state_key {
+  int seed;
+  int sequence_offset;
+  int replications;
+} rand_state_key;
+
+// FASTBOOTSTRAP_STATE_CACHE or empty, which keeps the snapshots in memory only
+std::string rand_state_directory();
+
+// false if there is no usable snapshot in memory or in the directory
+bool load_rand_states(const rand_state_key& key, const std::string& directory, std::vector<xorwow_state>* states);
+
+// false if the snapshot file could not be written, the in-memory copy is kept either way
+bool store_rand_states(const rand_state_key& key, const std::string& directory, const std::vector<xorwow_state>& states);
+
+void clear_rand_state_cache();
+
+#endif
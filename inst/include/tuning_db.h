@@ -0,0 +1,32 @@
+#ifndef TUNING_DB_H
+#define TUNING_DB_H
+
+#include <string>
+
+#include <opencl_utilities.h>
+
+// The tuning database is a text file with one line per device: <device key>\t<local item size>\t<variant>.
+// It lives at FASTBOOTSTRAP_TUNING_DB if set, otherwise in the user's cache directory.
+
+typedef struct t_tuning_entry {
+  int local_item_size;
+  std::string variant;
+} tuning_entry;
+
+std::string tuning_db_path();
+
+// vendor, name and driver version, so a driver update asks for a new tuning
+std::string tuning_device_key(cl_device_id device_id);
+
+// false if the device has not been tuned yet or the database cannot be read
+bool load_tuning(const std::string& device_key, tuning_entry* entry);
+
+void store_tuning(const std::string& device_key, const tuning_entry& entry);
+
+// creates every missing directory on the way to the file
+void make_parent_directories(const std::string& file);
+
+// a name next to the file that no other process or thread writes at the same time, for write-then-rename
+std::string temporary_path(const std::string& file);
+
+#endif
@@ -0,0 +1,441 @@
+#ifndef XORWOW_HOST_H
+#define XORWOW_HOST_H
+
+#include <opencl_utilities.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// host side of the xorwow generator in kernels.cl, it produces the same numbers as the device
+
+#define XORWOW_JUMP_MATRICES (32)
+#define XORWOW_MATRIX_WORDS (800)
+#define XORWOW_FEISTEL_ROUNDS (4)
+#define XORWOW_JUMP_DIGIT_BITS (4)
+#define XORWOW_JUMP_DIGITS (8)
+#define XORWOW_JUMP_DIGIT_VALUES (1 << XORWOW_JUMP_DIGIT_BITS)
+#define XORWOW_PAIRWISE_BLOCK (32)
+#define XORWOW_PAIRWISE_LEVELS (32)
+
+// the accumulators of summation_bootstrap_kernel, the values are the SUMMATION_* constants of kernels.cl
+enum summation_mode {
+  SUMMATION_NAIVE = 0,
+  SUMMATION_KAHAN = 1,
+  SUMMATION_PAIRWISE = 2,
+  SUMMATION_FIXED_POINT = 3
+};
+
+typedef struct t_xorwow_state {
+  cl_uint x[5];
+  cl_uint d;
+} xorwow_state;
+
+inline void xorwow_matvec_inplace(cl_uint *vector, const cl_uint *matrix)
+{
+  const int N = 5;
+  cl_uint result[N] = { 0 };
+  for(int i = 0; i < N; i++) {
+    for(int j = 0; j < 32; j++) {
+      if(vector[i] & (1u << j)) {
+        for(int k = 0; k < N; k++) {
+          result[k] ^= matrix[N * (i * 32 + j) + k];
+        }
+      }
+    }
+  }
+  for(int i = 0; i < N; i++) {
+    vector[i] = result[i];
+  }
+}
+
+// Row r of a matrix is the image of bit r. This is the matrix of a single draw.
+inline void xorwow_step_matrix(cl_uint *m)
+{
+  for(int r = 0; r < 160; r++) {
+    cl_uint *x = &m[5 * r];
+    memset(x, 0, 5 * sizeof(cl_uint));
+    x[r / 32] = 1u << (r % 32);
+    cl_uint t = x[0] ^ (x[0] >> 2);
+    x[0] = x[1];
+    x[1] = x[2];
+    x[2] = x[3];
+    x[3] = x[4];
+    x[4] = (x[4] ^ (x[4] << 4)) ^ (t ^ (t << 1));
+  }
+}
+
+// m becomes m^(2^squarings)
+inline void xorwow_square_matrix(std::vector<cl_uint>& m, int squarings)
+{
+  std::vector<cl_uint> squared(XORWOW_MATRIX_WORDS);
+  for(int s = 0; s < squarings; s++) {
+    for(int r = 0; r < 160; r++) {
+      memcpy(&squared[5 * r], &m[5 * r], 5 * sizeof(cl_uint));
+      xorwow_matvec_inplace(&squared[5 * r], &m[0]);
+    }
+    m.swap(squared);
+  }
+}
+
+// the same matrices as precalc_xorwow_matrix in kernels.cl: matrix k jumps 4^k subsequences of 2^67 draws,
+// built from the one-step transition by repeated squaring
+inline const cl_uint* xorwow_jump_matrices()
+{
+  static const std::vector<cl_uint> matrices = [] {
+    std::vector<cl_uint> out(XORWOW_JUMP_MATRICES * XORWOW_MATRIX_WORDS);
+    std::vector<cl_uint> m(XORWOW_MATRIX_WORDS);
+    xorwow_step_matrix(&m[0]);
+    int squarings = 67;
+    for(int k = 0; k < XORWOW_JUMP_MATRICES; k++) {
+      xorwow_square_matrix(m, squarings);
+      memcpy(&out[k * XORWOW_MATRIX_WORDS], &m[0], XORWOW_MATRIX_WORDS * sizeof(cl_uint));
+      squarings = 2;
+    }
+    return out;
+  }();
+  return &matrices[0];
+}
+
+// table (p, v) = step^v for v < 16, one block of XORWOW_JUMP_DIGIT_VALUES tables per hex digit p
+inline void xorwow_digit_powers(const cl_uint *step, cl_uint *tables)
+{
+  for(int r = 0; r < 160; r++) {
+    tables[5 * r + r / 32] = 1u << (r % 32);
+  }
+  for(int v = 1; v < XORWOW_JUMP_DIGIT_VALUES; v++) {
+    const cl_uint *previous = &tables[(v - 1) * XORWOW_MATRIX_WORDS];
+    cl_uint *table = &tables[v * XORWOW_MATRIX_WORDS];
+    for(int r = 0; r < 160; r++) {
+      memcpy(&table[5 * r], &previous[5 * r], 5 * sizeof(cl_uint));
+      xorwow_matvec_inplace(&table[5 * r], step);
+    }
+  }
+}
+
+// the jump tables of init_xorwow_kernel: table (p, v) jumps v * 16^p subsequences, so a sequence below 2^32 needs
+// at most one matrix per hex digit. Table (p, 0) is the identity and never applied.
+inline const std::vector<cl_uint>& xorwow_digit_tables()
+{
+  static const std::vector<cl_uint> tables = [] {
+    std::vector<cl_uint> out(XORWOW_JUMP_DIGITS * XORWOW_JUMP_DIGIT_VALUES * XORWOW_MATRIX_WORDS, 0);
+    const cl_uint *matrices = xorwow_jump_matrices();
+    for(int p = 0; p < XORWOW_JUMP_DIGITS; p++) {
+      // 16^p = 4^(2p)
+      xorwow_digit_powers(matrices + 2 * p * XORWOW_MATRIX_WORDS, &out[p * XORWOW_JUMP_DIGIT_VALUES * XORWOW_MATRIX_WORDS]);
+    }
+    return out;
+  }();
+  return tables;
+}
+
+// the skip tables of group_bootstrap_kernel, laid out like xorwow_digit_tables: table (p, v) advances one
+// sequence by v * 16^p draws, so any distance below 2^32 needs at most one matrix per hex digit
+inline const std::vector<cl_uint>& xorwow_skip_tables()
+{
+  static const std::vector<cl_uint> tables = [] {
+    std::vector<cl_uint> out(XORWOW_JUMP_DIGITS * XORWOW_JUMP_DIGIT_VALUES * XORWOW_MATRIX_WORDS, 0);
+    std::vector<cl_uint> step(XORWOW_MATRIX_WORDS);
+    xorwow_step_matrix(&step[0]);
+    for(int p = 0; p < XORWOW_JUMP_DIGITS; p++) {
+      xorwow_digit_powers(&step[0], &out[p * XORWOW_JUMP_DIGIT_VALUES * XORWOW_MATRIX_WORDS]);
+      xorwow_square_matrix(step, XORWOW_JUMP_DIGIT_BITS);
+    }
+    return out;
+  }();
+  return tables;
+}
+
+// init_xorwow_kernel for one subsequence
+inline void xorwow_init(xorwow_state *state, int seed, unsigned long long sequence)
+{
+  cl_uint s0 = ((cl_uint)seed) ^ 0xaad26b49UL;
+  cl_uint s1 = (cl_uint)(sequence >> 32) ^ 0xf7dcefddUL;
+  cl_uint t0 = 1099087573UL * s0;
+  cl_uint t1 = 2591861531UL * s1;
+  state->d = 6615241 + t1 + t0;
+  state->x[0] = 123456789UL + t0;
+  state->x[1] = 362436069UL ^ t0;
+  state->x[2] = 521288629UL + t1;
+  state->x[3] = 88675123UL ^ t1;
+  state->x[4] = 5783321UL + t0;
+
+  if(sequence < (1ULL << 32)) {
+    const cl_uint *tables = &xorwow_digit_tables()[0];
+    for(int p = 0; sequence; p++, sequence >>= XORWOW_JUMP_DIGIT_BITS) {
+      cl_uint digit = sequence & (XORWOW_JUMP_DIGIT_VALUES - 1);
+      if(digit) {
+        xorwow_matvec_inplace(state->x, tables + (p * XORWOW_JUMP_DIGIT_VALUES + digit) * XORWOW_MATRIX_WORDS);
+      }
+    }
+    return;
+  }
+  const cl_uint *matrices = xorwow_jump_matrices();
+  int matrix_num = 0;
+  while(sequence) {
+    for(unsigned int t = 0; t < (sequence & 3); t++) {
+      xorwow_matvec_inplace(state->x, matrices + matrix_num * XORWOW_MATRIX_WORDS);
+    }
+    sequence >>= 2;
+    matrix_num++;
+  }
+}
+
+// from subsequence i to i + 1 with a single matrix, valid as long as i + 1 < 2^32
+inline void xorwow_next_sequence(xorwow_state *state)
+{
+  xorwow_matvec_inplace(state->x, xorwow_jump_matrices());
+}
+
+// skip_draws of kernels.cl: the state after distance more draws, the Weyl counter d just adds up
+inline void xorwow_skip(xorwow_state *state, cl_uint distance)
+{
+  state->d += distance * 362437u;
+  const cl_uint *tables = &xorwow_skip_tables()[0];
+  for(int p = 0; distance; p++, distance >>= XORWOW_JUMP_DIGIT_BITS) {
+    cl_uint digit = distance & (XORWOW_JUMP_DIGIT_VALUES - 1);
+    if(digit) {
+      xorwow_matvec_inplace(state->x, tables + (p * XORWOW_JUMP_DIGIT_VALUES + digit) * XORWOW_MATRIX_WORDS);
+    }
+  }
+}
+
+inline cl_uint xorwow_next(xorwow_state *state)
+{
+  cl_uint t;
+  t = (state->x[0] ^ (state->x[0] >> 2));
+  state->x[0] = state->x[1];
+  state->x[1] = state->x[2];
+  state->x[2] = state->x[3];
+  state->x[3] = state->x[4];
+  state->x[4] = (state->x[4] ^ (state->x[4] << 4)) ^ (t ^ (t << 1));
+  state->d += 362437;
+  return state->x[4] + state->d;
+}
+
+// rand_uniform: 2^-32 is a power of two, so the product is exact and a fused multiply-add on the device gives the same float
+inline float xorwow_uniform(xorwow_state *state)
+{
+  const float two_pow_minus_32 = 2.3283064e-10f;
+  return (float) xorwow_next(state) * two_pow_minus_32 + (two_pow_minus_32 / 2.0f);
+}
+
+inline cl_uint xorwow_index(xorwow_state *state, cl_uint n)
+{
+  return (cl_uint)(((unsigned long long) xorwow_next(state) * n) >> 32);
+}
+
+typedef struct t_feistel_permutation_host {
+  cl_uint half_bits;
+  cl_uint half_mask;
+  cl_uint keys[XORWOW_FEISTEL_ROUNDS];
+} feistel_permutation_host;
+
+inline void feistel_init(feistel_permutation_host *permutation, xorwow_state *state, cl_uint n)
+{
+  cl_uint bits = 2;
+  while(bits < 32 && (1u << bits) < n) {
+    bits += 2;
+  }
+  permutation->half_bits = bits / 2;
+  permutation->half_mask = (1u << permutation->half_bits) - 1;
+  for(int r = 0; r < XORWOW_FEISTEL_ROUNDS; r++) {
+    permutation->keys[r] = xorwow_next(state);
+  }
+}
+
+inline cl_uint feistel_index(const feistel_permutation_host *permutation, cl_uint j, cl_uint n)
+{
+  cl_uint x = j;
+  do {
+    cl_uint left = x >> permutation->half_bits;
+    cl_uint right = x & permutation->half_mask;
+    for(int r = 0; r < XORWOW_FEISTEL_ROUNDS; r++) {
+      cl_uint f = right ^ permutation->keys[r];
+      f *= 0x9e3779b1u;
+      f ^= f >> 15;
+      f *= 0x85ebca6bu;
+      f ^= f >> 13;
+      cl_uint next = left ^ (f & permutation->half_mask);
+      left = right;
+      right = next;
+    }
+    x = (left << permutation->half_bits) | right;
+  } while(x >= n);
+  return x;
+}
+
+// init_xorwow_kernel for the replications 0 .. count - 1 of a manager with this sequence offset
+inline void host_init_rand_states(int seed, int sequence_offset, int count, xorwow_state *states)
+{
+  if(count <= 0) {
+    return;
+  }
+  xorwow_init(&states[0], seed, (unsigned int) sequence_offset);
+  for(int i = 1; i < count; i++) {
+    states[i] = states[i - 1];
+    xorwow_next_sequence(&states[i]);
+  }
+}
+
+// the kernels divide in double, which rounds a float quotient correctly, so host and device agree bit for bit
+template <typename T>
+T host_mean(T sum, int count)
+{
+  return (T) ((double) sum / count);
+}
+
+// kahan_add of kernels.cl
+template <typename T>
+void host_kahan_add(T *sum, T *compensation, T value)
+{
+  T t = *sum + value;
+  if(std::fabs(*sum) >= std::fabs(value)) {
+    *compensation += (*sum - t) + value;
+  } else {
+    *compensation += (value - t) + *sum;
+  }
+  *sum = t;
+}
+
+// pairwise_sum of kernels.cl
+template <typename T>
+struct host_pairwise_sum {
+  T block;
+  int in_block;
+  cl_uint blocks;
+  T levels[XORWOW_PAIRWISE_LEVELS];
+
+  host_pairwise_sum() : block(0), in_block(0), blocks(0) {}
+
+  void add(T value) {
+    block += value;
+    if(++in_block < XORWOW_PAIRWISE_BLOCK) {
+      return;
+    }
+    T carry = block;
+    int k = 0;
+    while(blocks & (1u << k)) {
+      carry = levels[k] + carry;
+      k++;
+    }
+    levels[k] = carry;
+    blocks++;
+    block = 0;
+    in_block = 0;
+  }
+
+  T total() const {
+    T sum = block;
+    for(int k = 0; k < XORWOW_PAIRWISE_LEVELS; k++) {
+      if(blocks & (1u << k)) {
+        sum = levels[k] + sum;
+      }
+    }
+    return sum;
+  }
+};
+
+// The largest scale 2^bits at which draws values of at most max_abs still sum into 62 bits. 0 for an input of
+// zeros, the caller has to reject values that are not finite.
+inline int host_fixed_point_bits(double max_abs, int draws)
+{
+  if(!(max_abs > 0) || !std::isfinite(max_abs)) {
+    return 0;
+  }
+  int exponent;
+  std::frexp(max_abs, &exponent);
+  int draw_bits = 0;
+  while(draw_bits < 31 && (1LL << draw_bits) < draws) {
+    draw_bits++;
+  }
+  int bits = 62 - exponent - draw_bits;
+  // ldexp(1.0f, bits) on the device has to stay a normal float
+  return bits > 127 ? 127 : (bits < -126 ? -126 : bits);
+}
+
+// fixed_point of kernels.cl: scaling a float by a power of two is exact, llrint rounds half to even like convert_long_rte
+template <typename T>
+long long host_fixed_point(T value, int bits)
+{
+  return std::llrint(std::ldexp((double) value, bits));
+}
+
+template <typename T>
+T host_mean_of_fixed_point(long long sum, int bits, int count)
+{
+  return (T) (std::ldexp((double) sum, -bits) / count);
+}
+
+inline cl_uint host_draw_index(xorwow_state *state, const feistel_permutation_host *permutation, int j, bool without_replacement, cl_uint n)
+{
+  return without_replacement ? feistel_index(permutation, j, n) : xorwow_index(state, n);
+}
+
+// one replication of bootstrap_kernel / subsample_kernel, or of summation_bootstrap_kernel for the other accumulators.
+// The draws are summed in the same order as on the device.
+template <typename T>
+T host_bootstrap_replication(xorwow_state state, const T *values, int nr_values, int resample_size, bool without_replacement,
+                             summation_mode summation = SUMMATION_NAIVE, int fixed_point_bits = 0)
+{
+  feistel_permutation_host permutation;
+  if(without_replacement) {
+    feistel_init(&permutation, &state, nr_values);
+  }
+  switch(summation) {
+  case SUMMATION_KAHAN: {
+    T sum = 0;
+    T compensation = 0;
+    for(int j = 0; j < resample_size; j++) {
+      host_kahan_add(&sum, &compensation, values[host_draw_index(&state, &permutation, j, without_replacement, nr_values)]);
+    }
+    return host_mean(sum + compensation, resample_size);
+  }
+  case SUMMATION_PAIRWISE: {
+    host_pairwise_sum<T> sum;
+    for(int j = 0; j < resample_size; j++) {
+      sum.add(values[host_draw_index(&state, &permutation, j, without_replacement, nr_values)]);
+    }
+    return host_mean(sum.total(), resample_size);
+  }
+  case SUMMATION_FIXED_POINT: {
+    long long sum = 0;
+    for(int j = 0; j < resample_size; j++) {
+      sum += host_fixed_point(values[host_draw_index(&state, &permutation, j, without_replacement, nr_values)], fixed_point_bits);
+    }
+    return host_mean_of_fixed_point<T>(sum, fixed_point_bits, resample_size);
+  }
+  default: {
+    T sum = 0;
+    for(int j = 0; j < resample_size; j++) {
+      sum += values[host_draw_index(&state, &permutation, j, without_replacement, nr_values)];
+    }
+    return host_mean(sum, resample_size);
+  }
+  }
+}
+
+// bootstrap_kernel for count replications from their rand states, host_simd.h has a vectorised version for float
+template <typename T>
+void host_bootstrap_states(const xorwow_state *states, int count, const T *values, int nr_values, int resample_size, T *output)
+{
+  for(int i = 0; i < count; i++) {
+    output[i] = host_bootstrap_replication(states[i], values, nr_values, resample_size, false);
+  }
+}
+
+// bootstrap_kernel / subsample_kernel for the replications first .. first + count - 1
+template <typename T>
+void host_bootstrap_range(const T *values, int nr_values, int resample_size, bool without_replacement, int seed, int first, int count, T *output)
+{
+  if(count <= 0) {
+    return;
+  }
+  xorwow_state sequence_state;
+  xorwow_init(&sequence_state, seed, first);
+  for(int i = 0; i < count; i++) {
+    output[i] = host_bootstrap_replication(sequence_state, values, nr_values, resample_size, without_replacement);
+    xorwow_next_sequence(&sequence_state);
+  }
+}
+
+#endif
@@ -0,0 +1,6 @@
+#include <bootstrap_manager.h>
+
+template class opencl_bootstrap_manager<float>;
+template class opencl_multi_device_bootstrap_manager<float>;
+template class opencl_work_stealing_bootstrap_manager<float>;
+template class cpu_bootstrap_manager<float>;
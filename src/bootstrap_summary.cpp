@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <bootstrap_error.h>
+#include <bootstrap_summary.h>
+
+void check_summary_arguments(int nr_bins, const std::vector<double>& probs) {
+  if (nr_bins < 1 || nr_bins > max_histogram_bins) {
+    throw bootstrap_error("the histogram needs 1 to " + std::to_string(max_histogram_bins) + " bins");
+  }
+  for (size_t p = 0; p < probs.size(); p++) {
+    if (!(probs[p] >= 0 && probs[p] <= 1)) {
+      throw bootstrap_error("quantile probabilities must be within 0 and 1");
+    }
+  }
+}
+
+// the bin edges of histogram_kernel
+static double bin_width(double low, double high, int nr_bins) {
+  return (high - low) / nr_bins;
+}
+
+void host_summary_partials(const float *means, int count, int nr_bins, std::vector<double> *partials, std::vector<unsigned int> *counts) {
+  partials->assign(summary_moments, 0);
+  (*partials)[2] = INFINITY;
+  (*partials)[3] = -INFINITY;
+  double shift = (count > 0) ? means[0] : 0;
+  (*partials)[4] = shift;
+  for (int i = 0; i < count; i++) {
+    double d = (double) means[i] - shift;
+    (*partials)[0] += d;
+    (*partials)[1] += d * d;
+    (*partials)[2] = std::min((*partials)[2], (double) means[i]);
+    (*partials)[3] = std::max((*partials)[3], (double) means[i]);
+  }
+
+  counts->assign(nr_bins, 0);
+  double width = bin_width((*partials)[2], (*partials)[3], nr_bins);
+  for (int i = 0; i < count; i++) {
+    int bin = (width > 0) ? (int) (((double) means[i] - (*partials)[2]) / width) : 0;
+    (*counts)[std::min(std::max(bin, 0), nr_bins - 1)]++;
+  }
+}
+
+bootstrap_summary finish_summary(const std::vector<double>& partials, const std::vector<unsigned int>& counts, int count, const std::vector<double>& probs) {
+  bootstrap_summary summary;
+  summary.replications = count;
+  double sum = 0;
+  double sum_sq = 0;
+  summary.min = INFINITY;
+  summary.max = -INFINITY;
+  // groups without any mean leave 0, 0, inf, -inf and the shift
+  for (size_t g = 0; g + summary_moments <= partials.size(); g += summary_moments) {
+    sum += partials[g];
+    sum_sq += partials[g + 1];
+    summary.min = std::min(summary.min, partials[g + 2]);
+    summary.max = std::max(summary.max, partials[g + 3]);
+  }
+
+  int nr_bins = counts.size();
+  double width = bin_width(summary.min, summary.max, nr_bins);
+  summary.mean = 0;
+  summary.se = 0;
+  if (count > 0) {
+    // every partial holds the same shift
+    summary.mean = partials[4] + sum / count;
+    if (count > 1) {
+      summary.se = std::sqrt(std::max(0.0, (sum_sq - sum * sum / count) / (count - 1)));
+    }
+  }
+
+  summary.breaks.resize(nr_bins + 1);
+  for (int b = 0; b < nr_bins; b++) {
+    summary.breaks[b] = summary.min + b * width;
+  }
+  summary.breaks[nr_bins] = summary.max;
+  summary.counts = counts;
+
+  for (size_t p = 0; p < probs.size(); p++) {
+    double target = probs[p] * count;
+    double before = 0;
+    double quantile = summary.max;
+    for (int b = 0; b < nr_bins; b++) {
+      if (counts[b] > 0 && before + counts[b] >= target) {
+        quantile = summary.breaks[b] + (target - before) / counts[b] * width;
+        break;
+      }
+      before += counts[b];
+    }
+    summary.quantiles.push_back(quantile);
+  }
+  return summary;
+}
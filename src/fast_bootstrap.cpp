@@ -1,200 +1,234 @@
 #include <Rcpp.h>
 
-#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
-#define CL_TARGET_OPENCL_VERSION 120
+#include <bootstrap_manager.h>
+#include <bootstrap_daemon.h>
 
-#include <CL/cl.h>
-#include <opencl_utilities.h>
+// the R interface: Rcpp modules turn the bootstrap_error exceptions of the engine into R errors
 
-typedef struct t_xorwow_state {
-  cl_uint x[5];
-  cl_uint d;
-} xorwow_state;
+#ifndef _WIN32
+typedef bootstrap_daemon_client<float> bootstrap_daemon_client_float;
 
-template <typename T>
-class opencl_bootstrap_manager {
-  
-  public:
+void run_bootstrap_daemon(std::string socket_path) {
+  serve_bootstrap_daemon<opencl_bootstrap_manager_float, float>(socket_path);
+}
 
-    opencl_bootstrap_manager(int replications_, int seed_)
-    {
-      set_local_item_size(32);
-      setup_device(replications_, seed_);
-    }
-  
-    void set_parameters(int replications_, int seed_) {
-      setup_device(replications_, seed_);
-    }
-  
-    void set_local_item_size(int item_size) {
-      local_item_size = (size_t) item_size;
-      global_item_size = (size_t) local_item_size * ceil( ((float) replications) / ((float) local_item_size) );
-    }
+void finalizer_bootstrap_daemon_client(bootstrap_daemon_client_float* ptr){
+  ptr->disconnect();
+}
 
-    std::vector<T> get_bootstrapped_means(std::vector<T> x) {
-      std::vector<T> h_out(replications);
-      calc_bootstrap_on_gpu(&x[0], &h_out[0], x.size());
-      return(h_out);
-    }
-  
-    ~opencl_bootstrap_manager() {
-
-    };
-    
-    void cleanup_device() {
-      CHECK_CL_ERROR(clFinish(command_queue));
-      CHECK_CL_ERROR(clReleaseCommandQueue(command_queue));
-      CHECK_CL_ERROR(clReleaseProgram(program));
-      CHECK_CL_ERROR(clReleaseContext(context));
-      CHECK_CL_ERROR(clReleaseKernel(bootstrap_kernel));
-      CHECK_CL_ERROR(clReleaseKernel(init_xorwow_kernel));
-      CHECK_CL_ERROR(clReleaseMemObject(buffer_rand_states));
-      CHECK_CL_ERROR(clReleaseMemObject(buffer_output));
-    }
-    
-    std::vector<unsigned int> test_rand_gen_device(int n = 10) {
-      cl_int err;
-      const size_t cl_n = n;
-      std::vector<unsigned int> output(n);
-      cl_kernel gen_random_kernel_int = clCreateKernel(program, "gen_random_kernel_int", &err);
-      cl_mem buffer_output_test = clCreateBuffer(context, CL_MEM_READ_WRITE, n * sizeof(unsigned int), NULL, &err);
-      
-      CHECK_CL_ERROR(clSetKernelArg(gen_random_kernel_int, 0, sizeof(cl_mem), (void *)&buffer_rand_states));
-      CHECK_CL_ERROR(clSetKernelArg(gen_random_kernel_int, 1, sizeof(cl_mem), (void *)&buffer_output_test));
-      CHECK_CL_ERROR(clSetKernelArg(gen_random_kernel_int, 2, sizeof(int), (void *)&n));
-      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, gen_random_kernel_int, 1, NULL, &cl_n, &cl_n, 0, NULL, NULL));
-
-      CHECK_CL_ERROR(clEnqueueReadBuffer(command_queue, buffer_output_test, CL_TRUE, 0, n * sizeof(unsigned int), &output[0], 0, NULL, NULL));
-      return(output);
-    }
-    
-  private:
-    
-    int replications;
-    cl_device_id device_id;
-    int seed;
-    size_t global_item_size;
-    size_t local_item_size;
-    kernel_source kernel_source_code;
-    cl_program program;
-    cl_context context;
-    cl_kernel bootstrap_kernel;
-    cl_kernel init_xorwow_kernel;
-    cl_command_queue command_queue = NULL;
-    cl_mem buffer_output = NULL;
-    cl_mem buffer_rand_states = NULL;
-    
-    
-    void set_default_device_id() {
-      cl_platform_id platform_id = NULL;
-      cl_device_id default_device_id = NULL;
-      cl_uint num_devices;
-      cl_uint num_platforms;
-      CHECK_CL_ERROR(clGetPlatformIDs(1, &platform_id, &num_platforms));
-      CHECK_CL_ERROR(clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_GPU, 1, &default_device_id, &num_devices));
-      device_id = default_device_id;
-    }
-    
-    void set_kernel_source() {
-      kernel_source_code = get_kernel_source("inst/include/kernels.cl");
-    }
-    
-    void init_rand_states_device() {
-      cl_int err;
-      
-      buffer_rand_states = clCreateBuffer(context, CL_MEM_READ_WRITE, replications * sizeof(xorwow_state), NULL, &err);
-
-      init_xorwow_kernel = clCreateKernel(program, "init_xorwow_kernel", &err);
-      CHECK_CL_ERROR_AFTER(err);
-      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 0, sizeof(cl_mem), (void *)&buffer_rand_states));
-      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 1, sizeof(int), (void *)&replications));
-      CHECK_CL_ERROR(clSetKernelArg(init_xorwow_kernel, 2, sizeof(int), (void *)&seed));
-
-      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, init_xorwow_kernel, 1, NULL, &global_item_size, &local_item_size, 0, NULL, NULL));
-      
+RCPP_EXPOSED_CLASS_NODECL(bootstrap_daemon_client_float)
+#endif
+
+// times in ns relative to the first queued command of the call
+Rcpp::DataFrame get_last_profile(opencl_bootstrap_manager_float* ptr) {
+  std::vector<profile_record> records = ptr->get_last_profile();
+  size_t n = records.size();
+  cl_ulong origin = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (i == 0 || records[i].queued < origin) {
+      origin = records[i].queued;
     }
+  }
+  Rcpp::CharacterVector stage(n), name(n);
+  Rcpp::NumericVector bytes(n), queued(n), submit(n), start(n), end(n);
+  for (size_t i = 0; i < n; i++) {
+    stage[i] = records[i].stage;
+    name[i] = records[i].name;
+    bytes[i] = records[i].bytes;
+    queued[i] = (double) (records[i].queued - origin);
+    submit[i] = (double) (records[i].submit - origin);
+    start[i] = (double) (records[i].start - origin);
+    end[i] = (double) (records[i].end - origin);
+  }
+  return Rcpp::DataFrame::create(Rcpp::Named("stage") = stage, Rcpp::Named("name") = name, Rcpp::Named("bytes") = bytes,
+                                 Rcpp::Named("queued_ns") = queued, Rcpp::Named("submit_ns") = submit,
+                                 Rcpp::Named("start_ns") = start, Rcpp::Named("end_ns") = end,
+                                 Rcpp::Named("stringsAsFactors") = false);
+}
 
-    void setup_device(int replications_, int seed_)
-    {
-      cl_int err;
-      
-      if (command_queue) {
-        CHECK_CL_ERROR(clFinish(command_queue));
-      }
-      if (buffer_rand_states) {
-        CHECK_CL_ERROR(clReleaseMemObject(buffer_rand_states));
-      }
-      if (buffer_output) {
-        CHECK_CL_ERROR(clReleaseMemObject(buffer_output));
-      }
-      
-      replications = replications_;
-      seed = seed_;
-      
-      set_default_device_id();
-      set_kernel_source();
-
-      context = clCreateContext(NULL, 1, &device_id, NULL, NULL, &err);
-      CHECK_CL_ERROR_AFTER(err);
-
-      program = clCreateProgramWithSource(context, 1, (const char **)&kernel_source_code.str, (const size_t *)&kernel_source_code.size, &err);
-      CHECK_CL_ERROR_AFTER(err);
-
-      err = clBuildProgram(program, 1, &device_id, NULL, NULL, NULL);
-      CHECK_CL_PROGRAM_ERROR(err, program, device_id);
-      CHECK_CL_ERROR_AFTER(err);
-      
-      bootstrap_kernel = clCreateKernel(program, "bootstrap_kernel", &err);
-      CHECK_CL_ERROR_AFTER(err);
-      
-      command_queue = clCreateCommandQueue(context, device_id, 0, &err);
-      CHECK_CL_ERROR_AFTER(err);
-      
-      buffer_output = clCreateBuffer(context, CL_MEM_WRITE_ONLY, replications * sizeof(T), NULL, &err);
-      CHECK_CL_ERROR_AFTER(err);
-      
-      init_rand_states_device();
-      
-      CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 0, sizeof(cl_mem), (void *)&buffer_rand_states));
-      CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 1, sizeof(int), (int *)&replications));
-      CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 2, sizeof(cl_mem), (void *)&buffer_output));
-      
-    }
-    
-    void calc_bootstrap_on_gpu(T* values, T* h_out, int nr_values) {
-      
-      cl_int err;
-      
-      cl_mem d_values = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, nr_values * sizeof(T), values, &err);
-      CHECK_CL_ERROR_AFTER(err);
-      CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 3, sizeof(cl_mem), (void *)&d_values));
-      CHECK_CL_ERROR(clSetKernelArg(bootstrap_kernel, 4, sizeof(int), (void *)&nr_values));
-      CHECK_CL_ERROR(clEnqueueNDRangeKernel(command_queue, bootstrap_kernel, 1, NULL, &global_item_size, &local_item_size, 0, NULL, NULL));
-      CHECK_CL_ERROR(clEnqueueReadBuffer(command_queue, buffer_output, CL_TRUE, 0, replications * sizeof(T), h_out, 0, NULL, NULL));
-      
-      CHECK_CL_ERROR(clReleaseMemObject(d_values));
+// NA_integer_ is INT_MIN to the engine, so it is caught here
+std::vector<int> integer_input(Rcpp::IntegerVector x) {
+  for (R_xlen_t i = 0; i < x.size(); i++) {
+    if (x[i] == NA_INTEGER) {
+      Rcpp::stop("the integer input must not contain NA");
     }
-};
+  }
+  return Rcpp::as<std::vector<int> >(x);
+}
+
+std::vector<float> get_bootstrapped_means_int(opencl_bootstrap_manager_float* ptr, Rcpp::IntegerVector x) {
+  return ptr->get_bootstrapped_means_int(integer_input(x));
+}
 
+std::vector<float> cpu_get_bootstrapped_means_int(cpu_bootstrap_manager_float* ptr, Rcpp::IntegerVector x) {
+  return ptr->get_bootstrapped_means_int(integer_input(x));
+}
+
+// a list like hist() plus the moments, the counts are doubles since R has no unsigned integers
+Rcpp::List summary_list(const bootstrap_summary& summary, const std::vector<double>& probs) {
+  Rcpp::NumericVector quantiles(summary.quantiles.begin(), summary.quantiles.end());
+  Rcpp::NumericVector counts(summary.counts.begin(), summary.counts.end());
+  return Rcpp::List::create(Rcpp::Named("replications") = summary.replications, Rcpp::Named("mean") = summary.mean,
+                            Rcpp::Named("se") = summary.se, Rcpp::Named("min") = summary.min, Rcpp::Named("max") = summary.max,
+                            Rcpp::Named("probs") = probs, Rcpp::Named("quantiles") = quantiles, Rcpp::Named("breaks") = summary.breaks,
+                            Rcpp::Named("counts") = counts);
+}
 
-typedef opencl_bootstrap_manager<float> opencl_bootstrap_manager_float;
+Rcpp::List get_bootstrap_summary(opencl_bootstrap_manager_float* ptr, std::vector<float> x, int nr_bins, std::vector<double> probs) {
+  return summary_list(ptr->get_bootstrap_summary(x, nr_bins, probs), probs);
+}
+
+Rcpp::List cpu_get_bootstrap_summary(cpu_bootstrap_manager_float* ptr, std::vector<float> x, int nr_bins, std::vector<double> probs) {
+  return summary_list(ptr->get_bootstrap_summary(x, nr_bins, probs), probs);
+}
+
+// one row per encoding, errors are Inf where the values do not fit
+Rcpp::DataFrame input_encoding_errors(std::vector<float> x) {
+  std::vector<encoding_error> errors = encoding_errors(x.data(), x.size());
+  size_t n = errors.size();
+  Rcpp::CharacterVector encoding(n);
+  Rcpp::IntegerVector bytes(n);
+  Rcpp::NumericVector abs_error(n), rel_error(n);
+  for (size_t i = 0; i < n; i++) {
+    encoding[i] = errors[i].encoding;
+    bytes[i] = errors[i].bytes_per_value;
+    abs_error[i] = errors[i].max_abs_error;
+    rel_error[i] = errors[i].max_rel_error;
+  }
+  return Rcpp::DataFrame::create(Rcpp::Named("encoding") = encoding, Rcpp::Named("bytes_per_value") = bytes,
+                                 Rcpp::Named("max_abs_error") = abs_error, Rcpp::Named("max_rel_error") = rel_error,
+                                 Rcpp::Named("stringsAsFactors") = false);
+}
+
+Rcpp::NumericVector get_profile_counters(opencl_bootstrap_manager_float* ptr) {
+  profile_counters c = ptr->get_profile_counters();
+  return Rcpp::NumericVector::create(Rcpp::Named("calls") = (double) c.calls, Rcpp::Named("writes") = (double) c.writes,
+                                     Rcpp::Named("kernels") = (double) c.kernels, Rcpp::Named("reads") = (double) c.reads,
+                                     Rcpp::Named("bytes_written") = (double) c.bytes_written, Rcpp::Named("bytes_read") = (double) c.bytes_read,
+                                     Rcpp::Named("write_ns") = (double) c.write_ns, Rcpp::Named("kernel_ns") = (double) c.kernel_ns,
+                                     Rcpp::Named("read_ns") = (double) c.read_ns);
+}
 
 void finalizer_opencl_bootstrap_manager(opencl_bootstrap_manager_float* ptr){
   ptr->cleanup_device();
 }
 
+void finalizer_opencl_multi_device_bootstrap_manager(opencl_multi_device_bootstrap_manager_float* ptr){
+  ptr->cleanup_device();
+}
+
+void finalizer_opencl_work_stealing_bootstrap_manager(opencl_work_stealing_bootstrap_manager_float* ptr){
+  ptr->cleanup_device();
+}
+
 RCPP_EXPOSED_CLASS_NODECL(opencl_bootstrap_manager_float)
+RCPP_EXPOSED_CLASS_NODECL(opencl_multi_device_bootstrap_manager_float)
+RCPP_EXPOSED_CLASS_NODECL(opencl_work_stealing_bootstrap_manager_float)
+RCPP_EXPOSED_CLASS_NODECL(cpu_bootstrap_manager_float)
 RCPP_MODULE(opencl_bootstrap_manager_float) {
   Rcpp::class_<opencl_bootstrap_manager_float>("opencl_bootstrap_manager_float")
   
   .constructor<int,int>("sets the nr of bootstrap samples and the seed")
   .method("get_bootstrapped_means", &opencl_bootstrap_manager_float::get_bootstrapped_means, "get bootstrapped means for numeric vector")
-  .method("set_local_item_size" ,&opencl_bootstrap_manager_float::set_local_item_size, "set opencl local item size (default is 32)")
+  .method("get_bootstrapped_means_batch", &opencl_bootstrap_manager_float::get_bootstrapped_means_batch, "get bootstrapped means for a list of numeric vectors, overlapping upload, compute and readback")
+  .method("get_bootstrapped_means_int", &get_bootstrapped_means_int, "get bootstrapped means for an integer vector, stored in 1, 2 or 4 bytes per value and summed exactly")
+  .method("get_weighted_bootstrapped_means", &opencl_bootstrap_manager_float::get_weighted_bootstrapped_means, "get bootstrapped means for a numeric vector with frequency weights (TRUE, draws sum(weights) values) or sampling weights (FALSE, draws length(x) values)")
+  .method("get_bootstrap_summary", &get_bootstrap_summary, "mean, standard error, min, max, quantiles at probs and an nr_bins histogram of the bootstrapped means, reduced on the device instead of reading back every mean")
+  .method("submit", &opencl_bootstrap_manager_float::submit, "start bootstrapping the means of a numeric vector without blocking, returns a job handle")
+  .method("ready", &opencl_bootstrap_manager_float::ready, "TRUE if the job has finished")
+  .method("wait", &opencl_bootstrap_manager_float::wait, "block until the job has finished")
+  .method("collect", &opencl_bootstrap_manager_float::collect, "wait for the job and return its bootstrapped means")
+  .method("jackknife", &opencl_bootstrap_manager_float::jackknife, "get the leave-one-out 'mean' or 'var' of a numeric vector, or only the BCa acceleration and the standard error if summary_only is TRUE")
+  .method("set_local_item_size" ,&opencl_bootstrap_manager_float::set_local_item_size, "set opencl local item size (default is 32, or the tuned size of the device)")
+  .method("autotune", &opencl_bootstrap_manager_float::autotune, "time the work-group sizes the device allows with both kernel variants, use the fastest and remember it for this device, returns the chosen size")
+  .method("set_kernel_variant", &opencl_bootstrap_manager_float::set_kernel_variant, "'gather' (one replication per work item) or 'vec4' (four as uint4/float4), default 'vec4' on devices that prefer int vectors, otherwise 'gather'")
+  .method("get_kernel_variant", &opencl_bootstrap_manager_float::get_kernel_variant, "the kernel variant of the plain bootstrap")
+  .method("set_input_encoding", &opencl_bootstrap_manager_float::set_input_encoding, "store uncompressed values as 'float' (default), 'half', 'bf16', 'int8' or 'int16' on the device, see input_encoding_errors")
+  .method("set_group_per_replication", &opencl_bootstrap_manager_float::set_group_per_replication, "run a work group per replication for few replications of many draws: 'auto' (default), 'always' or 'never'")
+  .method("set_resample_size", &opencl_bootstrap_manager_float::set_resample_size, "set the nr of draws per replication for m-out-of-n bootstrap and subsampling (0, the default, uses the length of the input)")
+  .method("set_sampling_mode", &opencl_bootstrap_manager_float::set_sampling_mode, "'replacement' (default) or 'subsampling' without replacement")
+  .method("set_compression", &opencl_bootstrap_manager_float::set_compression, "collapse inputs with few distinct values into value counts and draw multinomial counts per replication: 'auto' (default), 'always' or 'never'")
   .method("set_parameters", &opencl_bootstrap_manager_float::set_parameters, "set the nr of bootstrap samples and the seed, which then prepares the rand states")
+  .method("set_deterministic", &opencl_bootstrap_manager_float::set_deterministic, "only use the plain kernels, whose means equal cpu_bootstrap_manager_float's bit for bit (default FALSE)")
+  .method("set_summation", &opencl_bootstrap_manager_float::set_summation, "accumulator of the draws: 'naive' (default), 'kahan', 'pairwise' or 'fixed' (exact and order independent)")
+  .method("set_state_cache", &opencl_bootstrap_manager_float::set_state_cache, "directory for rand state snapshots reused by later runs with the same seed and nr of bootstrap samples (default FASTBOOTSTRAP_STATE_CACHE, \"\" keeps them in memory only)")
+  .method("set_profiling", &opencl_bootstrap_manager_float::set_profiling, "record the device times of every write, kernel and read (default FALSE)")
+  .method("get_last_profile", &get_last_profile, "data frame of the writes, kernels and reads of the last call with their queued/submit/start/end times in ns")
+  .method("get_profile_counters", &get_profile_counters, "calls, transfers, bytes and ns summed over all profiled calls")
+  .method("reset_profile_counters", &opencl_bootstrap_manager_float::reset_profile_counters, "set the profile counters back to 0")
   .method("test_rand_gen_device", &opencl_bootstrap_manager_float::test_rand_gen_device, "test random numbers generated on device")
   .finalizer(finalizer_opencl_bootstrap_manager )
   ;
   
+  Rcpp::class_<opencl_multi_device_bootstrap_manager_float>("opencl_multi_device_bootstrap_manager_float")
+  
+  .constructor<int,int,std::string>("sets the nr of bootstrap samples, the seed and the device type ('gpu', 'cpu' or 'all')")
+  .method("get_bootstrapped_means", &opencl_multi_device_bootstrap_manager_float::get_bootstrapped_means, "get bootstrapped means for numeric vector, sharded over all devices")
+  .method("set_local_item_size", &opencl_multi_device_bootstrap_manager_float::set_local_item_size, "set opencl local item size on all devices (default is 32)")
+  .method("set_resample_size", &opencl_multi_device_bootstrap_manager_float::set_resample_size, "set the nr of draws per replication (0 uses the length of the input)")
+  .method("set_sampling_mode", &opencl_multi_device_bootstrap_manager_float::set_sampling_mode, "'replacement' (default) or 'subsampling' without replacement")
+  .method("set_compression", &opencl_multi_device_bootstrap_manager_float::set_compression, "'auto' (default), 'always' or 'never'")
+  .method("set_deterministic", &opencl_multi_device_bootstrap_manager_float::set_deterministic, "only use the plain kernels on all devices (default FALSE)")
+  .method("set_summation", &opencl_multi_device_bootstrap_manager_float::set_summation, "'naive' (default), 'kahan', 'pairwise' or 'fixed' on all devices")
+  .method("set_input_encoding", &opencl_multi_device_bootstrap_manager_float::set_input_encoding, "'float' (default), 'half', 'bf16', 'int8' or 'int16' on all devices")
+  .method("set_group_per_replication", &opencl_multi_device_bootstrap_manager_float::set_group_per_replication, "'always' or 'never' (default, 'auto' is the same so that the shards add in one order) on all devices")
+  .method("set_parameters", &opencl_multi_device_bootstrap_manager_float::set_parameters, "set the nr of bootstrap samples and the seed, which then re-splits the shards")
+  .method("get_shard_sizes", &opencl_multi_device_bootstrap_manager_float::get_shard_sizes, "nr of replications computed by each device")
+  .method("get_throughput", &opencl_multi_device_bootstrap_manager_float::get_throughput, "measured replications per second of each device")
+  .finalizer(finalizer_opencl_multi_device_bootstrap_manager)
+  ;
+  
+  Rcpp::class_<opencl_work_stealing_bootstrap_manager_float>("opencl_work_stealing_bootstrap_manager_float")
+  
+  .constructor<int,int,std::string,int>("sets the nr of bootstrap samples, the seed, the device type ('gpu', 'cpu', 'all' or 'none') and the nr of host threads")
+  .method("get_bootstrapped_means", &opencl_work_stealing_bootstrap_manager_float::get_bootstrapped_means, "get bootstrapped means for numeric vector, with devices and host threads pulling chunks of replications")
+  .method("set_chunk_size", &opencl_work_stealing_bootstrap_manager_float::set_chunk_size, "set the nr of replications per chunk (0, the default, picks about 8 chunks per worker)")
+  .method("set_local_item_size", &opencl_work_stealing_bootstrap_manager_float::set_local_item_size, "set opencl local item size on all devices (default is 32)")
+  .method("set_resample_size", &opencl_work_stealing_bootstrap_manager_float::set_resample_size, "set the nr of draws per replication (0 uses the length of the input)")
+  .method("set_sampling_mode", &opencl_work_stealing_bootstrap_manager_float::set_sampling_mode, "'replacement' (default) or 'subsampling' without replacement")
+  .method("set_compression", &opencl_work_stealing_bootstrap_manager_float::set_compression, "'auto' (default), 'always' or 'never'")
+  .method("set_deterministic", &opencl_work_stealing_bootstrap_manager_float::set_deterministic, "only use the plain kernels on all devices (default FALSE)")
+  .method("set_summation", &opencl_work_stealing_bootstrap_manager_float::set_summation, "'naive' (default), 'kahan', 'pairwise' or 'fixed' on all devices and host threads")
+  .method("set_input_encoding", &opencl_work_stealing_bootstrap_manager_float::set_input_encoding, "'float' (default), 'half', 'bf16', 'int8' or 'int16' on all devices and host threads")
+  .method("set_group_per_replication", &opencl_work_stealing_bootstrap_manager_float::set_group_per_replication, "'always' (devices only) or 'never' (default, 'auto' is the same so that every chunk adds in one order) on all devices")
+  .method("set_parameters", &opencl_work_stealing_bootstrap_manager_float::set_parameters, "set the nr of bootstrap samples and the seed, which then prepares the rand states on every device")
+  .method("get_chunks_per_worker", &opencl_work_stealing_bootstrap_manager_float::get_chunks_per_worker, "chunks computed by each device and host thread in the last run")
+  .finalizer(finalizer_opencl_work_stealing_bootstrap_manager)
+  ;
+  
+  Rcpp::class_<cpu_bootstrap_manager_float>("cpu_bootstrap_manager_float")
+  
+  .constructor<int,int>("sets the nr of bootstrap samples and the seed")
+  .constructor<int,int,int>("sets the nr of bootstrap samples, the seed and the sequence offset of the first replication")
+  .method("get_bootstrapped_means", &cpu_bootstrap_manager_float::get_bootstrapped_means, "get bootstrapped means for numeric vector on the host, bit for bit the output of the device kernels")
+  .method("get_bootstrapped_means_int", &cpu_get_bootstrapped_means_int, "get bootstrapped means for an integer vector on the host, the same as the device")
+  .method("get_bootstrap_summary", &cpu_get_bootstrap_summary, "the summary of get_bootstrap_summary on the host, with the same histogram as the device in deterministic mode")
+  .method("set_parameters", &cpu_bootstrap_manager_float::set_parameters, "set the nr of bootstrap samples and the seed, which then prepares the rand states")
+  .method("set_resample_size", &cpu_bootstrap_manager_float::set_resample_size, "set the nr of draws per replication (0 uses the length of the input)")
+  .method("set_sampling_mode", &cpu_bootstrap_manager_float::set_sampling_mode, "'replacement' (default) or 'subsampling' without replacement")
+  .method("set_input_encoding", &cpu_bootstrap_manager_float::set_input_encoding, "'float' (default), 'half', 'bf16', 'int8' or 'int16', with the same means as the device")
+  .method("set_summation", &cpu_bootstrap_manager_float::set_summation, "'naive' (default), 'kahan', 'pairwise' or 'fixed', with the same means as the device")
+  .method("test_rand_gen", &cpu_bootstrap_manager_float::test_rand_gen, "the random numbers test_rand_gen_device returns for the same seed")
+  ;
+  
+#ifndef _WIN32
+  Rcpp::class_<bootstrap_daemon_client_float>("bootstrap_daemon_client_float")
+  
+  .constructor<std::string,int,int>("connects to the daemon socket and sets the nr of bootstrap samples and the seed")
+  .method("get_bootstrapped_means", &bootstrap_daemon_client_float::get_bootstrapped_means, "get bootstrapped means for numeric vector from the daemon")
+  .method("set_parameters", &bootstrap_daemon_client_float::set_parameters, "set the nr of bootstrap samples and the seed")
+  .method("set_resample_size", &bootstrap_daemon_client_float::set_resample_size, "set the nr of draws per replication (0 uses the length of the input)")
+  .method("set_sampling_mode", &bootstrap_daemon_client_float::set_sampling_mode, "'replacement' (default) or 'subsampling' without replacement")
+  .method("set_compression", &bootstrap_daemon_client_float::set_compression, "'auto' (default), 'always' or 'never'")
+  .finalizer(finalizer_bootstrap_daemon_client)
+  ;
+  
+  Rcpp::function("run_bootstrap_daemon", &run_bootstrap_daemon, "serve bootstrap requests of other processes on a unix socket until shutdown_bootstrap_daemon is called");
+  Rcpp::function("shutdown_bootstrap_daemon", &shutdown_bootstrap_daemon, "stop the bootstrap daemon listening on the unix socket");
+#endif
+  
+  Rcpp::function("input_encoding_errors", &input_encoding_errors, "largest absolute and relative error of every input encoding for a numeric vector, which also bounds the error of any bootstrapped mean");
+  Rcpp::function("host_simd_isa", &host_simd_isa, "instruction set of the host bootstrap: 'avx512', 'avx2' or 'scalar'");
   Rcpp::function("print_opencl_platforms", &print_opencl_platforms, "print all available opencl platforms");
   Rcpp::function("print_opencl_devices", &print_opencl_devices, "print all available opencl devices");
 }
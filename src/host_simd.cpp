@@ -0,0 +1,169 @@
+#include <cstdlib>
+#include <cstring>
+
+#include <host_simd.h>
+
+// the scalar path of 32-bit x86 may keep the sums in x87 registers, so only x86-64 is vectorised
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define HOST_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// the states of width replications as one row per word, lane l of each row belongs to replication l
+template <int width>
+static void transpose_states(const xorwow_state *states, cl_uint rows[6][width])
+{
+  for(int l = 0; l < width; l++) {
+    for(int k = 0; k < 5; k++) {
+      rows[k][l] = states[l].x[k];
+    }
+    rows[5][l] = states[l].d;
+  }
+}
+
+#ifdef HOST_SIMD_X86
+
+__attribute__((target("avx2")))
+static void bootstrap_avx2(const xorwow_state *states, const float *values, int nr_values, int resample_size, float *output)
+{
+  cl_uint rows[6][8];
+  transpose_states<8>(states, rows);
+  __m256i x0 = _mm256_loadu_si256((const __m256i *) rows[0]);
+  __m256i x1 = _mm256_loadu_si256((const __m256i *) rows[1]);
+  __m256i x2 = _mm256_loadu_si256((const __m256i *) rows[2]);
+  __m256i x3 = _mm256_loadu_si256((const __m256i *) rows[3]);
+  __m256i x4 = _mm256_loadu_si256((const __m256i *) rows[4]);
+  __m256i d = _mm256_loadu_si256((const __m256i *) rows[5]);
+  const __m256i weyl = _mm256_set1_epi32(362437);
+  const __m256i n = _mm256_set1_epi32(nr_values);
+  __m256 sum = _mm256_setzero_ps();
+
+  for(int j = 0; j < resample_size; j++) {
+    __m256i t = _mm256_xor_si256(x0, _mm256_srli_epi32(x0, 2));
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+    x3 = x4;
+    x4 = _mm256_xor_si256(_mm256_xor_si256(x4, _mm256_slli_epi32(x4, 4)), _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+    d = _mm256_add_epi32(d, weyl);
+    __m256i r = _mm256_add_epi32(x4, d);
+    // mul_hi(r, n): the even lanes multiply in place, the odd ones after shifting down, their high words are blended
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(r, n), 32);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(r, 32), n);
+    __m256i index = _mm256_blend_epi32(even, odd, 0xAA);
+    sum = _mm256_add_ps(sum, _mm256_i32gather_ps(values, index, 4));
+  }
+
+  float sums[8];
+  _mm256_storeu_ps(sums, sum);
+  for(int l = 0; l < 8; l++) {
+    output[l] = host_mean(sums[l], resample_size);
+  }
+}
+
+__attribute__((target("avx512f")))
+static void bootstrap_avx512(const xorwow_state *states, const float *values, int nr_values, int resample_size, float *output)
+{
+  cl_uint rows[6][16];
+  transpose_states<16>(states, rows);
+  __m512i x0 = _mm512_loadu_si512(rows[0]);
+  __m512i x1 = _mm512_loadu_si512(rows[1]);
+  __m512i x2 = _mm512_loadu_si512(rows[2]);
+  __m512i x3 = _mm512_loadu_si512(rows[3]);
+  __m512i x4 = _mm512_loadu_si512(rows[4]);
+  __m512i d = _mm512_loadu_si512(rows[5]);
+  const __m512i weyl = _mm512_set1_epi32(362437);
+  const __m512i n = _mm512_set1_epi32(nr_values);
+  // the unmasked shifts, multiplies and gathers start from _mm512_undefined_*, which GCC 12 reports with -Wall as
+  // maybe uninitialized, so the masked forms run on all lanes from an explicit zero
+  const __m512i zero = _mm512_setzero_si512();
+  const __mmask16 lanes = 0xFFFF;
+  const __mmask8 pairs = 0xFF;
+  __m512 sum = _mm512_setzero_ps();
+
+  for(int j = 0; j < resample_size; j++) {
+    __m512i t = _mm512_xor_si512(x0, _mm512_mask_srli_epi32(zero, lanes, x0, 2));
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+    x3 = x4;
+    x4 = _mm512_xor_si512(_mm512_xor_si512(x4, _mm512_mask_slli_epi32(zero, lanes, x4, 4)), _mm512_xor_si512(t, _mm512_mask_slli_epi32(zero, lanes, t, 1)));
+    d = _mm512_add_epi32(d, weyl);
+    __m512i r = _mm512_add_epi32(x4, d);
+    __m512i even = _mm512_mask_srli_epi64(zero, pairs, _mm512_mask_mul_epu32(zero, pairs, r, n), 32);
+    __m512i odd = _mm512_mask_mul_epu32(zero, pairs, _mm512_mask_srli_epi64(zero, pairs, r, 32), n);
+    __m512i index = _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    sum = _mm512_add_ps(sum, _mm512_mask_i32gather_ps(_mm512_setzero_ps(), lanes, index, values, 4));
+  }
+
+  float sums[16];
+  _mm512_storeu_ps(sums, sum);
+  for(int l = 0; l < 16; l++) {
+    output[l] = host_mean(sums[l], resample_size);
+  }
+}
+
+static int supported_width() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return 16;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return 8;
+  }
+  return 1;
+}
+
+#else
+
+static int supported_width() {
+  return 1;
+}
+
+#endif
+
+// FASTBOOTSTRAP_HOST_ISA=avx2 or scalar caps the instruction set, e.g. to compare the paths
+static int detect_width() {
+  int width = supported_width();
+  const char* isa = getenv("FASTBOOTSTRAP_HOST_ISA");
+  if (isa && strcmp(isa, "scalar") == 0) {
+    width = 1;
+  } else if (isa && strcmp(isa, "avx2") == 0 && width > 8) {
+    width = 8;
+  }
+  return width;
+}
+
+int host_simd_width() {
+  static const int width = detect_width();
+  return width;
+}
+
+const char* host_simd_isa() {
+  switch (host_simd_width()) {
+    case 16:
+      return "avx512";
+    case 8:
+      return "avx2";
+    default:
+      return "scalar";
+  }
+}
+
+void host_bootstrap_states(const xorwow_state *states, int count, const float *values, int nr_values, int resample_size, float *output)
+{
+  int i = 0;
+#ifdef HOST_SIMD_X86
+  int width = host_simd_width();
+  for(; width > 1 && i + width <= count; i += width) {
+    if (width == 16) {
+      bootstrap_avx512(states + i, values, nr_values, resample_size, output + i);
+    } else {
+      bootstrap_avx2(states + i, values, nr_values, resample_size, output + i);
+    }
+  }
+#endif
+  for(; i < count; i++) {
+    output[i] = host_bootstrap_replication(states[i], values, nr_values, resample_size, false);
+  }
+}
@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <CL/cl_half.h>
+#include <bootstrap_error.h>
+#include <host_simd.h>
+#include <input_encoding.h>
+
+static const char* encoding_names[] = { "float", "half", "bf16", "int8", "int16" };
+static const int nr_encodings = sizeof(encoding_names) / sizeof(encoding_names[0]);
+
+input_encoding parse_input_encoding(const std::string& name) {
+  for (int e = 0; e < nr_encodings; e++) {
+    if (name == encoding_names[e]) {
+      return (input_encoding) e;
+    }
+  }
+  throw bootstrap_error("unknown input encoding '" + name + "', use 'float', 'half', 'bf16', 'int8' or 'int16'");
+}
+
+const char* input_encoding_name(input_encoding encoding) {
+  return encoding_names[encoding];
+}
+
+int encoded_value_bytes(input_encoding encoding) {
+  switch (encoding) {
+    case ENCODING_INT8:
+      return 1;
+    case ENCODING_HALF:
+    case ENCODING_BFLOAT16:
+    case ENCODING_INT16:
+      return 2;
+    default:
+      return 4;
+  }
+}
+
+// the upper half of the float, rounded to nearest even
+static cl_ushort bfloat16_from_float(float value) {
+  cl_uint bits;
+  memcpy(&bits, &value, sizeof(bits));
+  bits += 0x7fff + ((bits >> 16) & 1);
+  return (cl_ushort) (bits >> 16);
+}
+
+static float bfloat16_to_float(cl_ushort value) {
+  cl_uint bits = ((cl_uint) value) << 16;
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+static int max_code(input_encoding encoding) {
+  return (encoding == ENCODING_INT8) ? 255 : 65535;
+}
+
+void encode_values(const float *values, int nr_values, input_encoding encoding, encoded_values *encoded) {
+  if (nr_values <= 0) {
+    throw bootstrap_error("the input needs at least one value");
+  }
+  encoded->encoding = encoding;
+  encoded->scale = 1;
+  encoded->offset = 0;
+  encoded->bytes.assign((size_t) nr_values * encoded_value_bytes(encoding), 0);
+  double min_value = 0;
+  double max_value = 0;
+  for (int i = 0; i < nr_values; i++) {
+    if (!std::isfinite(values[i])) {
+      throw bootstrap_error(std::string("the ") + input_encoding_name(encoding) + " encoding needs finite values");
+    }
+    min_value = (i == 0) ? values[i] : std::min(min_value, (double) values[i]);
+    max_value = (i == 0) ? values[i] : std::max(max_value, (double) values[i]);
+  }
+
+  switch (encoding) {
+    case ENCODING_HALF: {
+      if (std::max(-min_value, max_value) > 65504.0) {
+        throw bootstrap_error("the half encoding only holds values within +-65504");
+      }
+      cl_half* out = (cl_half*) &encoded->bytes[0];
+      for (int i = 0; i < nr_values; i++) {
+        out[i] = cl_half_from_float(values[i], CL_HALF_RTE);
+      }
+      break;
+    }
+    case ENCODING_BFLOAT16: {
+      cl_ushort* out = (cl_ushort*) &encoded->bytes[0];
+      for (int i = 0; i < nr_values; i++) {
+        out[i] = bfloat16_from_float(values[i]);
+        if (!std::isfinite(bfloat16_to_float(out[i]))) {
+          throw bootstrap_error("the bf16 encoding rounds values near the float maximum to infinity");
+        }
+      }
+      break;
+    }
+    case ENCODING_INT8:
+    case ENCODING_INT16: {
+      int levels = max_code(encoding);
+      // all values equal: every code is 0 and the offset is the value
+      encoded->offset = (float) min_value;
+      encoded->scale = (float) ((max_value - min_value) / levels);
+      for (int i = 0; i < nr_values; i++) {
+        double code = 0;
+        if (encoded->scale > 0) {
+          code = std::nearbyint(((double) values[i] - encoded->offset) / encoded->scale);
+          code = std::min(std::max(code, 0.0), (double) levels);
+        }
+        if (encoding == ENCODING_INT8) {
+          encoded->bytes[i] = (unsigned char) code;
+        } else {
+          ((cl_ushort*) &encoded->bytes[0])[i] = (cl_ushort) code;
+        }
+      }
+      break;
+    }
+    default:
+      memcpy(&encoded->bytes[0], values, (size_t) nr_values * sizeof(float));
+      break;
+  }
+}
+
+static cl_uint decode_code(const encoded_values& encoded, int i) {
+  if (encoded.encoding == ENCODING_INT8) {
+    return encoded.bytes[i];
+  }
+  return ((const cl_ushort*) &encoded.bytes[0])[i];
+}
+
+// offset + scale * x rounded after the multiply, like mean_of_codes under FP_CONTRACT OFF. The volatile product keeps
+// the host compiler (and -ffp-contract=fast, the GCC default) from fusing it into an fma.
+static double scale_code(const encoded_values& encoded, double x) {
+  volatile double scaled = (double) encoded.scale * x;
+  return (double) encoded.offset + scaled;
+}
+
+double decode_value(const encoded_values& encoded, int i) {
+  switch (encoded.encoding) {
+    case ENCODING_HALF:
+      return cl_half_to_float(((const cl_half*) &encoded.bytes[0])[i]);
+    case ENCODING_BFLOAT16:
+      return bfloat16_to_float(((const cl_ushort*) &encoded.bytes[0])[i]);
+    case ENCODING_INT8:
+    case ENCODING_INT16:
+      return scale_code(encoded, decode_code(encoded, i));
+    default:
+      return ((const float*) &encoded.bytes[0])[i];
+  }
+}
+
+std::vector<encoding_error> encoding_errors(const float *values, int nr_values) {
+  // encode_values rejects it too, but every encoding would then look infinitely far off
+  if (nr_values <= 0) {
+    throw bootstrap_error("the input needs at least one value");
+  }
+  std::vector<encoding_error> errors;
+  for (int e = 0; e < nr_encodings; e++) {
+    encoding_error error;
+    error.encoding = encoding_names[e];
+    error.bytes_per_value = encoded_value_bytes((input_encoding) e);
+    error.max_abs_error = 0;
+    error.max_rel_error = 0;
+    try {
+      encoded_values encoded;
+      encode_values(values, nr_values, (input_encoding) e, &encoded);
+      for (int i = 0; i < nr_values; i++) {
+        double abs_error = std::fabs(decode_value(encoded, i) - values[i]);
+        error.max_abs_error = std::max(error.max_abs_error, abs_error);
+        if (values[i] != 0) {
+          error.max_rel_error = std::max(error.max_rel_error, abs_error / std::fabs((double) values[i]));
+        }
+      }
+    } catch (const bootstrap_error&) {
+      // the values do not fit
+      error.max_abs_error = INFINITY;
+      error.max_rel_error = INFINITY;
+    }
+    errors.push_back(error);
+  }
+  return errors;
+}
+
+void host_encoded_bootstrap_states(const xorwow_state *states, int count, const encoded_values& encoded, int nr_values, int resample_size, bool without_replacement, float *output) {
+  // the widened half and bfloat16 values are plain floats, whose bootstrap the host already has
+  if (encoded.encoding != ENCODING_INT8 && encoded.encoding != ENCODING_INT16) {
+    std::vector<float> decoded(nr_values);
+    for (int i = 0; i < nr_values; i++) {
+      decoded[i] = (float) decode_value(encoded, i);
+    }
+    if (without_replacement) {
+      for (int r = 0; r < count; r++) {
+        output[r] = host_bootstrap_replication(states[r], &decoded[0], nr_values, resample_size, true);
+      }
+    } else {
+      host_bootstrap_states(states, count, &decoded[0], nr_values, resample_size, output);
+    }
+    return;
+  }
+
+  for (int r = 0; r < count; r++) {
+    xorwow_state state = states[r];
+    feistel_permutation_host permutation;
+    if (without_replacement) {
+      feistel_init(&permutation, &state, nr_values);
+    }
+    unsigned long long sum = 0;
+    for (int j = 0; j < resample_size; j++) {
+      sum += decode_code(encoded, host_draw_index(&state, &permutation, j, without_replacement, nr_values));
+    }
+    // mean_of_codes of kernels.cl
+    output[r] = (float) scale_code(encoded, (double) sum / resample_size);
+  }
+}
+
+void encode_integers(const int *values, int nr_values, encoded_integers *encoded) {
+  long long min_value = 0;
+  long long max_value = 0;
+  for (int i = 0; i < nr_values; i++) {
+    min_value = (i == 0) ? values[i] : std::min(min_value, (long long) values[i]);
+    max_value = (i == 0) ? values[i] : std::max(max_value, (long long) values[i]);
+  }
+  long long range = max_value - min_value;
+  encoded->value_bytes = (range <= 0xff) ? 1 : (range <= 0xffff) ? 2 : 4;
+  encoded->offset = min_value;
+  encoded->bytes.assign((size_t) nr_values * encoded->value_bytes, 0);
+  for (int i = 0; i < nr_values; i++) {
+    cl_uint code = (cl_uint) (values[i] - min_value);
+    if (encoded->value_bytes == 1) {
+      encoded->bytes[i] = (unsigned char) code;
+    } else if (encoded->value_bytes == 2) {
+      ((cl_ushort*) &encoded->bytes[0])[i] = (cl_ushort) code;
+    } else {
+      ((cl_uint*) &encoded->bytes[0])[i] = code;
+    }
+  }
+}
+
+static cl_uint integer_code(const encoded_integers& encoded, cl_uint i) {
+  if (encoded.value_bytes == 1) {
+    return encoded.bytes[i];
+  } else if (encoded.value_bytes == 2) {
+    return ((const cl_ushort*) &encoded.bytes[0])[i];
+  }
+  return ((const cl_uint*) &encoded.bytes[0])[i];
+}
+
+void host_integer_bootstrap_states(const xorwow_state *states, int count, const encoded_integers& encoded, int nr_values, int resample_size, bool without_replacement, float *output) {
+  for (int r = 0; r < count; r++) {
+    xorwow_state state = states[r];
+    feistel_permutation_host permutation;
+    if (without_replacement) {
+      feistel_init(&permutation, &state, nr_values);
+    }
+    unsigned long long sum = 0;
+    for (int j = 0; j < resample_size; j++) {
+      sum += integer_code(encoded, host_draw_index(&state, &permutation, j, without_replacement, nr_values));
+    }
+    // mean_of_total of kernels.cl
+    long long total = (long long) sum + encoded.offset * resample_size;
+    output[r] = (float) ((double) total / resample_size);
+  }
+}
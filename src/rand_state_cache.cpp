@@ -0,0 +1,145 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <sstream>
+
+#include <rand_state_cache.h>
+#include <tuning_db.h>
+
+typedef struct t_rand_state_snapshot {
+  rand_state_key key;
+  std::vector<xorwow_state> states;
+} rand_state_snapshot;
+
+// the front is the most recently used snapshot
+static std::mutex snapshots_mutex;
+static std::list<rand_state_snapshot> snapshots;
+static size_t snapshot_bytes = 0;
+
+// the header of a snapshot file, the states follow as they are laid out on the device
+typedef struct t_rand_state_header {
+  char magic[4];
+  cl_uint format;
+  cl_uint state_size;
+  cl_int seed;
+  cl_int sequence_offset;
+  cl_int replications;
+} rand_state_header;
+
+static bool same_key(const rand_state_key& a, const rand_state_key& b) {
+  return a.seed == b.seed && a.sequence_offset == b.sequence_offset && a.replications == b.replications;
+}
+
+static rand_state_header header_for(const rand_state_key& key) {
+  rand_state_header header;
+  memcpy(header.magic, "FBRS", 4);
+  header.format = RAND_STATE_FORMAT;
+  header.state_size = sizeof(xorwow_state);
+  header.seed = key.seed;
+  header.sequence_offset = key.sequence_offset;
+  header.replications = key.replications;
+  return header;
+}
+
+static std::string snapshot_path(const rand_state_key& key, const std::string& directory) {
+  std::ostringstream path;
+  path << directory << "/xorwow_" << key.seed << "_" << key.sequence_offset << "_" << key.replications << ".bin";
+  return path.str();
+}
+
+static void remember(const rand_state_key& key, const std::vector<xorwow_state>& states) {
+  size_t bytes = states.size() * sizeof(xorwow_state);
+  if (bytes > RAND_STATE_CACHE_BYTES) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(snapshots_mutex);
+  for (std::list<rand_state_snapshot>::iterator it = snapshots.begin(); it != snapshots.end(); ++it) {
+    if (same_key(it->key, key)) {
+      snapshots.splice(snapshots.begin(), snapshots, it);
+      return;
+    }
+  }
+  while (!snapshots.empty() && snapshot_bytes + bytes > RAND_STATE_CACHE_BYTES) {
+    snapshot_bytes -= snapshots.back().states.size() * sizeof(xorwow_state);
+    snapshots.pop_back();
+  }
+  rand_state_snapshot snapshot = { key, states };
+  snapshots.push_front(snapshot);
+  snapshot_bytes += bytes;
+}
+
+std::string rand_state_directory() {
+  const char* directory = getenv("FASTBOOTSTRAP_STATE_CACHE");
+  return (directory && *directory) ? directory : "";
+}
+
+bool load_rand_states(const rand_state_key& key, const std::string& directory, std::vector<xorwow_state>* states) {
+  {
+    std::lock_guard<std::mutex> lock(snapshots_mutex);
+    for (std::list<rand_state_snapshot>::iterator it = snapshots.begin(); it != snapshots.end(); ++it) {
+      if (same_key(it->key, key)) {
+        snapshots.splice(snapshots.begin(), snapshots, it);
+        *states = it->states;
+        return true;
+      }
+    }
+  }
+  if (directory.empty()) {
+    return false;
+  }
+
+  FILE* file = fopen(snapshot_path(key, directory).c_str(), "rb");
+  if (!file) {
+    return false;
+  }
+  rand_state_header expected = header_for(key);
+  rand_state_header header;
+  bool loaded = false;
+  if (fread(&header, sizeof(header), 1, file) == 1 && memcmp(&header, &expected, sizeof(header)) == 0) {
+    states->resize(key.replications);
+    loaded = fread(&(*states)[0], sizeof(xorwow_state), key.replications, file) == (size_t) key.replications;
+  }
+  fclose(file);
+  if (loaded) {
+    remember(key, *states);
+  }
+  return loaded;
+}
+
+// written next to the final name and renamed, so a concurrent reader never sees half a snapshot
+bool store_rand_states(const rand_state_key& key, const std::string& directory, const std::vector<xorwow_state>& states) {
+  remember(key, states);
+  if (directory.empty()) {
+    return true;
+  }
+
+  std::string path = snapshot_path(key, directory);
+  std::string temporary = temporary_path(path);
+  make_parent_directories(path);
+  FILE* file = fopen(temporary.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  rand_state_header header = header_for(key);
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+    fwrite(&states[0], sizeof(xorwow_state), states.size(), file) == states.size();
+  written = (fclose(file) == 0) && written;
+#ifdef _WIN32
+  if (written) {
+    remove(path.c_str());
+  }
+#endif
+  if (!written || rename(temporary.c_str(), path.c_str()) != 0) {
+    remove(temporary.c_str());
+    return false;
+  }
+  return true;
+}
+
+void clear_rand_state_cache() {
+  std::lock_guard<std::mutex> lock(snapshots_mutex);
+  snapshots.clear();
+  snapshot_bytes = 0;
+}
@@ -0,0 +1,147 @@
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <tuning_db.h>
+
+static std::string device_info_string(cl_device_id device_id, cl_device_info info) {
+  size_t size = 0;
+  CHECK_CL_ERROR(clGetDeviceInfo(device_id, info, 0, NULL, &size));
+  std::string value(size, '\0');
+  CHECK_CL_ERROR(clGetDeviceInfo(device_id, info, size, &value[0], NULL));
+  value = value.c_str();
+  // tabs and newlines separate the fields of the database
+  for (size_t i = 0; i < value.size(); i++) {
+    if (value[i] == '\t' || value[i] == '\n' || value[i] == '\r') {
+      value[i] = ' ';
+    }
+  }
+  return value;
+}
+
+static void make_directory(const std::string& path) {
+#ifdef _WIN32
+  _mkdir(path.c_str());
+#else
+  mkdir(path.c_str(), 0755);
+#endif
+}
+
+void make_parent_directories(const std::string& file) {
+  for (size_t i = 1; i < file.size(); i++) {
+    if (file[i] == '/' || file[i] == '\\') {
+      make_directory(file.substr(0, i));
+    }
+  }
+}
+
+std::string temporary_path(const std::string& file) {
+  static std::atomic<unsigned int> next_file(0);
+#ifdef _WIN32
+  int pid = _getpid();
+#else
+  int pid = getpid();
+#endif
+  std::ostringstream path;
+  path << file << '.' << pid << '.' << next_file++ << ".tmp";
+  return path.str();
+}
+
+std::string tuning_db_path() {
+  const char* path = getenv("FASTBOOTSTRAP_TUNING_DB");
+  if (path && *path) {
+    return path;
+  }
+#ifdef _WIN32
+  const char* base = getenv("LOCALAPPDATA");
+  if (base && *base) {
+    return std::string(base) + "\\fastbootstrap\\tuning.db";
+  }
+#else
+  const char* base = getenv("XDG_CACHE_HOME");
+  if (base && *base) {
+    return std::string(base) + "/fastbootstrap/tuning.db";
+  }
+  const char* home = getenv("HOME");
+  if (home && *home) {
+    return std::string(home) + "/.cache/fastbootstrap/tuning.db";
+  }
+#endif
+  return "fastbootstrap_tuning.db";
+}
+
+std::string tuning_device_key(cl_device_id device_id) {
+  return device_info_string(device_id, CL_DEVICE_VENDOR) + " | " + device_info_string(device_id, CL_DEVICE_NAME) + " | " + device_info_string(device_id, CL_DRIVER_VERSION);
+}
+
+bool load_tuning(const std::string& device_key, tuning_entry* entry) {
+  std::ifstream in(tuning_db_path().c_str());
+  std::string line;
+  while (std::getline(in, line)) {
+    size_t first_tab = line.find('\t');
+    size_t second_tab = line.find('\t', first_tab + 1);
+    if (first_tab == std::string::npos || second_tab == std::string::npos || line.substr(0, first_tab) != device_key) {
+      continue;
+    }
+    int local_item_size = atoi(line.substr(first_tab + 1, second_tab - first_tab - 1).c_str());
+    if (local_item_size <= 0) {
+      return false;
+    }
+    entry->local_item_size = local_item_size;
+    entry->variant = line.substr(second_tab + 1);
+    return true;
+  }
+  return false;
+}
+
+// the file is rewritten next to the old one and renamed over it, so concurrent readers never see half a file
+void store_tuning(const std::string& device_key, const tuning_entry& entry) {
+  std::string path = tuning_db_path();
+  std::vector<std::string> lines;
+  {
+    std::ifstream in(path.c_str());
+    std::string line;
+    while (std::getline(in, line)) {
+      if (!line.empty() && line.substr(0, line.find('\t')) != device_key) {
+        lines.push_back(line);
+      }
+    }
+  }
+  std::ostringstream line;
+  line << device_key << '\t' << entry.local_item_size << '\t' << entry.variant;
+  lines.push_back(line.str());
+
+  make_parent_directories(path);
+  std::string temporary = temporary_path(path);
+  {
+    std::ofstream out(temporary.c_str(), std::ios::trunc);
+    for (size_t i = 0; i < lines.size(); i++) {
+      out << lines[i] << '\n';
+    }
+    if (!out) {
+      out.close();
+      remove(temporary.c_str());
+      throw bootstrap_error("could not write the tuning database " + temporary);
+    }
+  }
+#ifdef _WIN32
+  remove(path.c_str());
+#endif
+  if (rename(temporary.c_str(), path.c_str()) != 0) {
+    remove(temporary.c_str());
+    throw bootstrap_error("could not replace the tuning database " + path + ": " + strerror(errno));
+  }
+}
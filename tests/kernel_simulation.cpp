@@ -0,0 +1,141 @@
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <CL/cl_half.h>
+
+// the OpenCL C that kernels.cl uses, mapped to C++
+
+#define __kernel extern "C"
+#define __global
+#define __local
+#define __constant const
+#define __private
+#define CLK_LOCAL_MEM_FENCE 1
+#define CLK_GLOBAL_MEM_FENCE 2
+
+typedef unsigned int uint;
+typedef unsigned short ushort;
+typedef unsigned char uchar;
+typedef unsigned long ulong;
+typedef ushort half;
+
+using std::abs;
+using std::exp;
+using std::fabs;
+using std::floor;
+using std::fmax;
+using std::fmin;
+using std::ldexp;
+using std::log;
+using std::max;
+using std::min;
+using std::sqrt;
+
+static thread_local size_t item_global_id;
+static thread_local size_t item_local_id;
+static size_t ndrange_offset;
+static size_t ndrange_global_size;
+static size_t ndrange_local_size;
+
+static size_t get_global_id(uint) { return item_global_id; }
+static size_t get_local_id(uint) { return item_local_id; }
+static size_t get_group_id(uint) { return (item_global_id - ndrange_offset) / ndrange_local_size; }
+static size_t get_local_size(uint) { return ndrange_local_size; }
+static size_t get_global_size(uint) { return ndrange_global_size; }
+static size_t get_global_offset(uint) { return ndrange_offset; }
+
+static std::mutex barrier_mutex;
+static std::condition_variable barrier_released;
+static size_t barrier_arrived = 0;
+static size_t barrier_generation = 0;
+
+static void barrier(int) {
+  std::unique_lock<std::mutex> lock(barrier_mutex);
+  size_t generation = barrier_generation;
+  if (++barrier_arrived == ndrange_local_size) {
+    barrier_arrived = 0;
+    barrier_generation++;
+    barrier_released.notify_all();
+  } else {
+    barrier_released.wait(lock, [&] { return barrier_generation != generation; });
+  }
+}
+
+static uint clz(uint x) { return x ? __builtin_clz(x) : 32; }
+static uint mul_hi(uint a, uint b) { return (uint) (((unsigned long long) a * b) >> 32); }
+static uint atomic_inc(volatile uint *p) { return __atomic_fetch_add(p, 1, __ATOMIC_SEQ_CST); }
+static uint atomic_add(volatile uint *p, uint v) { return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST); }
+static uint atomic_xor(volatile uint *p, uint v) { return __atomic_fetch_xor(p, v, __ATOMIC_SEQ_CST); }
+static long convert_long_rte(float v) { return lrintf(v); }
+static float vload_half(size_t i, const ushort *p) { return cl_half_to_float(p[i]); }
+static float as_float(uint x) { float f; memcpy(&f, &x, sizeof(f)); return f; }
+static int clamp(int v, int low, int high) { return v < low ? low : (v > high ? high : v); }
+
+struct uint4 {
+  uint s0, s1, s2, s3;
+};
+static uint4 make_uint4(uint a) { uint4 v = { a, a, a, a }; return v; }
+static uint4 make_uint4(uint a, uint b, uint c, uint d) { uint4 v = { a, b, c, d }; return v; }
+static uint4 operator^(uint4 a, uint4 b) { return make_uint4(a.s0 ^ b.s0, a.s1 ^ b.s1, a.s2 ^ b.s2, a.s3 ^ b.s3); }
+static uint4 operator+(uint4 a, uint4 b) { return make_uint4(a.s0 + b.s0, a.s1 + b.s1, a.s2 + b.s2, a.s3 + b.s3); }
+static uint4& operator+=(uint4& a, unsigned int b) { a = a + make_uint4(b); return a; }
+static uint4 operator>>(uint4 a, int k) { return make_uint4(a.s0 >> k, a.s1 >> k, a.s2 >> k, a.s3 >> k); }
+static uint4 operator<<(uint4 a, int k) { return make_uint4(a.s0 << k, a.s1 << k, a.s2 << k, a.s3 << k); }
+static uint4 mul_hi(uint4 a, uint4 b) { return make_uint4(mul_hi(a.s0, b.s0), mul_hi(a.s1, b.s1), mul_hi(a.s2, b.s2), mul_hi(a.s3, b.s3)); }
+
+struct float4 {
+  float s0, s1, s2, s3;
+};
+static float4 make_float4(float a) { float4 v = { a, a, a, a }; return v; }
+static float4 make_float4(float a, float b, float c, float d) { float4 v = { a, b, c, d }; return v; }
+static float4& operator+=(float4& a, float4 b) { a.s0 += b.s0; a.s1 += b.s1; a.s2 += b.s2; a.s3 += b.s3; return a; }
+
+// generated by CMake from inst/include/kernels.cl
+#include "kernels_host.cl"
+
+// one thread per local item, reused for every group: the items of a group have to run at the same time to meet at
+// the barriers, but starting a thread per item would dominate the tests
+void run_ndrange(size_t global_offset, size_t global_size, size_t local_size, const std::function<void()>& work_item) {
+  ndrange_offset = global_offset;
+  ndrange_global_size = global_size;
+  ndrange_local_size = local_size;
+  std::mutex group_mutex;
+  std::condition_variable group_started, group_finished;
+  size_t nr_groups = global_size / local_size;
+  size_t started = 0;
+  size_t finished = 0;
+  std::vector<std::thread> items;
+  for (size_t l = 0; l < local_size; l++) {
+    items.push_back(std::thread([&, l] {
+      for (size_t g = 0; g < nr_groups; g++) {
+        {
+          std::unique_lock<std::mutex> lock(group_mutex);
+          group_started.wait(lock, [&] { return started > g; });
+        }
+        item_global_id = global_offset + g * local_size + l;
+        item_local_id = l;
+        work_item();
+        std::unique_lock<std::mutex> lock(group_mutex);
+        if (++finished == local_size) {
+          group_finished.notify_one();
+        }
+      }
+    }));
+  }
+  for (size_t group = 0; group < nr_groups; group++) {
+    std::unique_lock<std::mutex> lock(group_mutex);
+    finished = 0;
+    started = group + 1;
+    group_started.notify_all();
+    group_finished.wait(lock, [&] { return finished == local_size; });
+  }
+  for (size_t l = 0; l < local_size; l++) {
+    items[l].join();
+  }
+}
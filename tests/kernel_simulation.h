@@ -0,0 +1,35 @@
+#ifndef KERNEL_SIMULATION_H
+#define KERNEL_SIMULATION_H
+
+#include <cstddef>
+#include <functional>
+
+#include <xorwow_host.h>
+
+// kernels.cl compiled as C++ (kernel_simulation.cpp), so the tests can compare the kernels with the host reference
+// without an OpenCL device. The items of a work group run as threads, one group after the other, so barriers and
+// __local memory behave as on a device.
+
+// calls work_item once per item of the NDRange, get_global_id and friends answer for the calling item
+void run_ndrange(size_t global_offset, size_t global_size, size_t local_size, const std::function<void()>& work_item);
+
+// the kernels take the same arguments as on the device, xorwow_state has the layout of the kernels' struct
+extern "C" {
+void init_xorwow_kernel(xorwow_state *rand_states, int replications, int seed, int sequence_offset, const unsigned int *jump_tables);
+void bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, float *values, int nr_of_values, int resample_size);
+void bootstrap_vec4_kernel(xorwow_state *rand_states, int replications, float *output, float *values, int nr_of_values, int resample_size);
+void group_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, float *values, int nr_of_values, int resample_size, const unsigned int *skip_tables, float *partial_sums);
+void subsample_kernel(xorwow_state *rand_states, int replications, float *output, float *values, int nr_of_values, int resample_size);
+void summation_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, float *values, int nr_of_values, int resample_size, int subsample, int summation, int fixed_point_bits);
+void encoded_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, const unsigned char *values, int nr_of_values, int resample_size, int subsample, int encoding, float scale, float offset);
+void integer_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, const unsigned char *values, int nr_of_values, int resample_size, int subsample, int value_bytes, long offset);
+void weighted_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, float *values, int nr_of_values, int resample_size, float *alias_prob, int *alias_index);
+void multinomial_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, float *category_values, int nr_of_categories, int resample_size, double *conditional_probs);
+void binomial_bootstrap_kernel(xorwow_state *rand_states, int replications, float *output, int successes, int nr_of_values, int resample_size);
+void summary_partial_kernel(const float *means, int count, double *partials, double *scratch);
+void histogram_kernel(const float *means, int count, const double *partials, int nr_partials, int nr_bins, unsigned int *histogram, unsigned int *local_bins);
+void jackknife_mean_kernel(float *values, int nr_of_values, double total, float *output);
+void jackknife_var_kernel(float *values, int nr_of_values, float *output);
+}
+
+#endif
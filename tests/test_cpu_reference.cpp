@@ -0,0 +1,647 @@
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <bootstrap_manager.h>
+#include <bootstrap_summary.h>
+#include <input_encoding.h>
+
+#include "kernel_simulation.h"
+
+// cpu_bootstrap_manager is the reference the kernels are regression-tested against:
+//   cpu_reference_test host    its rand states against the jump tables and the simulated kernels against it
+//   cpu_reference_test device  the device in deterministic mode against it, exits with 77 (skipped) without a device
+
+static int failures = 0;
+
+static void expect(bool condition, const std::string& what) {
+  if (!condition) {
+    printf("FAILED: %s\n", what.c_str());
+    failures++;
+  }
+}
+
+static bool same_states(const xorwow_state& a, const xorwow_state& b) {
+  return memcmp(&a, &b, sizeof(xorwow_state)) == 0;
+}
+
+static bool same_floats(const std::vector<float>& a, const std::vector<float>& b) {
+  return a.size() == b.size() && memcmp(&a[0], &b[0], a.size() * sizeof(float)) == 0;
+}
+
+static std::vector<float> test_values(int nr_values) {
+  std::vector<float> values(nr_values);
+  xorwow_state state;
+  xorwow_init(&state, 99, 0);
+  for (int i = 0; i < nr_values; i++) {
+    values[i] = 50.0f + 10.0f * (xorwow_uniform(&state) - 0.5f);
+  }
+  return values;
+}
+
+static size_t global_size_for(int items, size_t local_size) {
+  return (items + local_size - 1) / local_size * local_size;
+}
+
+// Pearson's chi-square of the samples against pmf, neighbouring cells are merged until each expects at least 5, and
+// the sample mean against the mean of pmf. Either fails beyond about 5 standard deviations (the chi-square via
+// Wilson-Hilferty), so a correct sampler passes for a fixed seed but a misshaped or slightly shifted one does not.
+static bool fits_distribution(const std::vector<int>& samples, const std::vector<double>& pmf) {
+  std::vector<double> observed(pmf.size(), 0);
+  double sample_mean = 0;
+  for (size_t i = 0; i < samples.size(); i++) {
+    if (samples[i] < 0 || samples[i] >= (int) pmf.size()) {
+      return false;
+    }
+    observed[samples[i]]++;
+    sample_mean += samples[i];
+  }
+  double n = samples.size();
+  sample_mean /= n;
+  double mean = 0, variance = 0;
+  for (size_t k = 0; k < pmf.size(); k++) {
+    mean += k * pmf[k];
+  }
+  for (size_t k = 0; k < pmf.size(); k++) {
+    variance += (k - mean) * (k - mean) * pmf[k];
+  }
+  if (fabs(sample_mean - mean) > 5 * sqrt(variance / n)) {
+    return false;
+  }
+  std::vector<double> cell_expected, cell_observed;
+  double expected = 0, seen = 0;
+  for (size_t k = 0; k < pmf.size(); k++) {
+    expected += n * pmf[k];
+    seen += observed[k];
+    if (expected >= 5) {
+      cell_expected.push_back(expected);
+      cell_observed.push_back(seen);
+      expected = seen = 0;
+    }
+  }
+  if (cell_expected.size() < 2) {
+    return false;
+  }
+  cell_expected.back() += expected;
+  cell_observed.back() += seen;
+  double chi2 = 0;
+  for (size_t c = 0; c < cell_expected.size(); c++) {
+    chi2 += (cell_observed[c] - cell_expected[c]) * (cell_observed[c] - cell_expected[c]) / cell_expected[c];
+  }
+  double df = cell_expected.size() - 1;
+  double h = 2.0 / (9.0 * df);
+  return chi2 < df * pow(1 - h + 4.75 * sqrt(h), 3);
+}
+
+static std::vector<double> binomial_pmf(int n, double p) {
+  std::vector<double> pmf(n + 1);
+  for (int k = 0; k <= n; k++) {
+    pmf[k] = exp(lgamma(n + 1.0) - lgamma(k + 1.0) - lgamma(n - k + 1.0) + k * log(p) + (n - k) * log1p(-p));
+  }
+  return pmf;
+}
+
+// the resampled sum of a kernel whose sums are exact integers, from its float mean
+static std::vector<int> sums_of_means(const std::vector<float>& means, int resample_size) {
+  std::vector<int> sums(means.size());
+  for (size_t i = 0; i < means.size(); i++) {
+    sums[i] = (int) lrint((double) means[i] * resample_size);
+  }
+  return sums;
+}
+
+// sequence via the 2-bit jump matrices, the path of xorwow_init beyond 2^32 sequences
+static xorwow_state state_by_jump_matrices(int seed, unsigned long long sequence) {
+  xorwow_state state;
+  xorwow_init(&state, seed, 0);
+  const cl_uint *matrices = xorwow_jump_matrices();
+  for (int matrix_num = 0; sequence; matrix_num++, sequence >>= 2) {
+    for (unsigned int t = 0; t < (sequence & 3); t++) {
+      xorwow_matvec_inplace(state.x, matrices + matrix_num * XORWOW_MATRIX_WORDS);
+    }
+  }
+  return state;
+}
+
+static void check_rand_states() {
+  const int seeds[] = { 0, 2023, -7 };
+  const int offsets[] = { 0, 5, 1000, 70000 };
+  const int count = 300;
+  for (int s = 0; s < 3; s++) {
+    for (int o = 0; o < 4; o++) {
+      std::vector<xorwow_state> states(count);
+      host_init_rand_states(seeds[s], offsets[o], count, &states[0]);
+      bool by_digits = true;
+      bool by_matrices = true;
+      for (int i = 0; i < count; i++) {
+        xorwow_state state;
+        xorwow_init(&state, seeds[s], offsets[o] + i);
+        by_digits = by_digits && same_states(state, states[i]);
+        by_matrices = by_matrices && same_states(state_by_jump_matrices(seeds[s], offsets[o] + i), states[i]);
+      }
+      std::string name = "seed " + std::to_string(seeds[s]) + " offset " + std::to_string(offsets[o]);
+      expect(by_digits, "host_init_rand_states against the digit tables, " + name);
+      expect(by_matrices, "host_init_rand_states against the jump matrices, " + name);
+
+      // a local size that does not divide the replications
+      std::vector<xorwow_state> device(count);
+      const std::vector<cl_uint>& tables = xorwow_digit_tables();
+      size_t local_size = 16;
+      size_t global_size = (count + local_size - 1) / local_size * local_size;
+      run_ndrange(0, global_size, local_size, [&] { init_xorwow_kernel(&device[0], count, seeds[s], offsets[o], &tables[0]); });
+      expect(memcmp(&device[0], &states[0], count * sizeof(xorwow_state)) == 0, "init_xorwow_kernel against host_init_rand_states, " + name);
+    }
+  }
+
+  // the skip tables against single steps
+  const cl_uint distances[] = { 1, 17, 1000, 65537 };
+  for (int d = 0; d < 4; d++) {
+    xorwow_state skipped;
+    xorwow_init(&skipped, 11, 3);
+    xorwow_state stepped = skipped;
+    xorwow_skip(&skipped, distances[d]);
+    for (cl_uint k = 0; k < distances[d]; k++) {
+      xorwow_next(&stepped);
+    }
+    expect(same_states(skipped, stepped), "xorwow_skip over " + std::to_string(distances[d]) + " draws");
+  }
+}
+
+static void check_samplers() {
+  const int replications = 200;
+  const int seed = 2023;
+  const int nr_values = 1001;
+  std::vector<float> values = test_values(nr_values);
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(seed, 0, replications, &states[0]);
+  size_t local_size = 32;
+  size_t global_size = (replications + local_size - 1) / local_size * local_size;
+  const int resample_sizes[] = { nr_values, 257 };
+
+  for (int r = 0; r < 2; r++) {
+    int m = resample_sizes[r];
+    cpu_bootstrap_manager<float> reference(replications, seed);
+    reference.set_resample_size(m);
+    std::string name = "resample size " + std::to_string(m);
+
+    std::vector<float> device(replications);
+    run_ndrange(0, global_size, local_size, [&] { bootstrap_kernel(&states[0], replications, &device[0], &values[0], nr_values, m); });
+    expect(same_floats(device, reference.get_bootstrapped_means(values)), "bootstrap_kernel against the reference, " + name);
+
+    reference.set_sampling_mode("subsampling");
+    run_ndrange(0, global_size, local_size, [&] { subsample_kernel(&states[0], replications, &device[0], &values[0], nr_values, m); });
+    expect(same_floats(device, reference.get_bootstrapped_means(values)), "subsample_kernel (Feistel) against the reference, " + name);
+  }
+
+  // an arbitrary alias table: column i keeps itself with probability alias_prob[i], otherwise it yields alias_index[i]
+  std::vector<float> alias_prob(nr_values);
+  std::vector<int> alias_index(nr_values);
+  for (int i = 0; i < nr_values; i++) {
+    alias_prob[i] = (i % 7) / 7.0f + 0.1f;
+    alias_index[i] = (i * 31) % nr_values;
+  }
+  std::vector<float> expected(replications);
+  for (int i = 0; i < replications; i++) {
+    xorwow_state state = states[i];
+    float sum = 0;
+    for (int j = 0; j < nr_values; j++) {
+      cl_uint column = xorwow_index(&state, nr_values);
+      int k = (xorwow_uniform(&state) < alias_prob[column]) ? (int) column : alias_index[column];
+      sum += values[k];
+    }
+    expected[i] = host_mean(sum, nr_values);
+  }
+  std::vector<float> device(replications);
+  run_ndrange(0, global_size, local_size, [&] { weighted_bootstrap_kernel(&states[0], replications, &device[0], &values[0], nr_values, nr_values, &alias_prob[0], &alias_index[0]); });
+  expect(same_floats(device, expected), "weighted_bootstrap_kernel against the alias draws on the host");
+}
+
+// bootstrap_vec4_kernel against bootstrap_kernel bit for bit, over all replications and over a range as
+// calc_bootstrap_range launches it (global offset first, replications argument first + count). Neither count is a
+// multiple of 4, so the last work item repeats its last replication in the unused components.
+static void check_vec4_kernel() {
+  const int replications = 203;
+  const int nr_values = 1001;
+  const size_t local_size = 16;
+  std::vector<float> values = test_values(nr_values);
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(7, 0, replications, &states[0]);
+  const int resample_sizes[] = { nr_values, 257 };
+
+  for (int r = 0; r < 2; r++) {
+    int m = resample_sizes[r];
+    std::string name = "resample size " + std::to_string(m);
+    std::vector<float> expected(replications);
+    run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { bootstrap_kernel(&states[0], replications, &expected[0], &values[0], nr_values, m); });
+
+    // the outputs are padded with -1 to catch stores past the last replication
+    std::vector<float> output(replications + 4, -1.0f);
+    run_ndrange(0, global_size_for((replications + 3) / 4, local_size), local_size, [&] { bootstrap_vec4_kernel(&states[0], replications, &output[0], &values[0], nr_values, m); });
+    expect(std::count(output.begin() + replications, output.end(), -1.0f) == 4, "bootstrap_vec4_kernel writes only its replications, " + name);
+    output.resize(replications);
+    expect(same_floats(output, expected), "bootstrap_vec4_kernel against bootstrap_kernel, " + name);
+
+    // 3 + 4k replications in the range, so the last work item stores 3 of its 4 components
+    const int first = 40, count = 103;
+    std::vector<float> range(replications, -1.0f);
+    run_ndrange(first, global_size_for((count + 3) / 4, local_size), local_size, [&] { bootstrap_vec4_kernel(&states[0], first + count, &range[0], &values[0], nr_values, m); });
+    bool outside_untouched = true;
+    for (int i = 0; i < replications; i++) {
+      if (i < first || i >= first + count) {
+        outside_untouched = outside_untouched && range[i] == -1.0f;
+        range[i] = expected[i];
+      }
+    }
+    expect(outside_untouched, "bootstrap_vec4_kernel writes only its range, " + name);
+    expect(same_floats(range, expected), "bootstrap_vec4_kernel over a range against bootstrap_kernel, " + name);
+  }
+}
+
+// group_bootstrap_kernel draws what bootstrap_kernel draws but adds the chunks of its items in a tree, so the means
+// agree up to rounding: each float sum of m draws is off by at most (m - 1) 2^-24 sum |x|, so the means differ by at
+// most 2 (m - 1) 2^-24 max |x|. One draw more, less or out of sequence moves a mean by about a value / m, far beyond.
+// The resample sizes do not divide the local sizes, so the last items get a short or an empty chunk, and 48 items
+// reduce over a tree padded to 64.
+static void check_group_kernel() {
+  const int replications = 30;
+  const int nr_values = 1001;
+  std::vector<float> values = test_values(nr_values);
+  float max_abs = 0;
+  for (int i = 0; i < nr_values; i++) {
+    max_abs = std::max(max_abs, std::fabs(values[i]));
+  }
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(11, 0, replications, &states[0]);
+  const std::vector<cl_uint>& skip_tables = xorwow_skip_tables();
+  // resample size, local size
+  const int cases[][2] = { { 1001, 64 }, { 1000, 48 }, { 257, 48 }, { 37, 64 } };
+
+  for (int c = 0; c < 4; c++) {
+    int m = cases[c][0];
+    size_t local_size = cases[c][1];
+    std::string name = "resample size " + std::to_string(m) + ", local size " + std::to_string(local_size);
+    std::vector<float> expected(replications);
+    run_ndrange(0, global_size_for(replications, 32), 32, [&] { bootstrap_kernel(&states[0], replications, &expected[0], &values[0], nr_values, m); });
+
+    // all replications, then a range from the global work offset as calc_bootstrap_range launches it
+    std::vector<float> partial_sums(local_size);
+    std::vector<float> output(replications);
+    run_ndrange(0, replications * local_size, local_size, [&] { group_bootstrap_kernel(&states[0], replications, &output[0], &values[0], nr_values, m, &skip_tables[0], &partial_sums[0]); });
+    const int first = 5, count = 20;
+    std::vector<float> range(replications, -1.0f);
+    run_ndrange(first, count * local_size, local_size, [&] { group_bootstrap_kernel(&states[0], first + count, &range[0], &values[0], nr_values, m, &skip_tables[0], &partial_sums[0]); });
+
+    double tolerance = 2.0 * (m - 1) * std::ldexp(1.0, -24) * max_abs;
+    double worst = 0;
+    bool range_matches = true;
+    for (int i = 0; i < replications; i++) {
+      worst = std::max(worst, std::fabs((double) output[i] - expected[i]));
+      bool in_range = i >= first && i < first + count;
+      range_matches = range_matches && (in_range ? range[i] == output[i] : range[i] == -1.0f);
+    }
+    expect(worst <= tolerance, "group_bootstrap_kernel against bootstrap_kernel, " + name + ": off by " + std::to_string(worst) + ", allowed " + std::to_string(tolerance));
+    expect(range_matches, "group_bootstrap_kernel over a range, " + name);
+  }
+}
+
+// summation_bootstrap_kernel against host_bootstrap_replication bit for bit for every accumulator, with and without
+// replacement. The values span 1e-3 to 1e4 with both signs, so the accumulators round differently from each other,
+// and 5000 draws fill several levels of the pairwise sum.
+static void check_summation_kernel() {
+  const int replications = 100;
+  const int nr_values = 1001;
+  const size_t local_size = 32;
+  std::vector<float> values = test_values(nr_values);
+  for (int i = 0; i < nr_values; i += 3) {
+    values[i] = (i % 2 ? -1 : 1) * std::ldexp(values[i], (i % 25) - 10);
+  }
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(5, 0, replications, &states[0]);
+  const summation_mode modes[] = { SUMMATION_NAIVE, SUMMATION_KAHAN, SUMMATION_PAIRWISE, SUMMATION_FIXED_POINT };
+  const char* mode_names[] = { "naive", "kahan", "pairwise", "fixed point" };
+  // subsample, resample size
+  const int cases[][2] = { { 0, nr_values }, { 0, 5000 }, { 1, nr_values }, { 1, 700 } };
+
+  for (int c = 0; c < 4; c++) {
+    int subsample = cases[c][0], m = cases[c][1];
+    int fixed_point_bits = host_fixed_point_bits(max_abs_value(&values[0], nr_values), m);
+    std::vector<std::vector<float> > outputs;
+    for (int s = 0; s < 4; s++) {
+      std::string name = std::string(mode_names[s]) + (subsample ? ", subsampling " : ", replacement ") + std::to_string(m);
+      std::vector<float> expected(replications);
+      for (int i = 0; i < replications; i++) {
+        expected[i] = host_bootstrap_replication(states[i], &values[0], nr_values, m, subsample != 0, modes[s], fixed_point_bits);
+      }
+      std::vector<float> output(replications);
+      run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { summation_bootstrap_kernel(&states[0], replications, &output[0], &values[0], nr_values, m, subsample, modes[s], fixed_point_bits); });
+      expect(same_floats(output, expected), "summation_bootstrap_kernel against the host, " + name);
+      outputs.push_back(output);
+    }
+    // otherwise a kernel that ignores the accumulator would pass
+    expect(!same_floats(outputs[0], outputs[1]) && !same_floats(outputs[0], outputs[2]) && !same_floats(outputs[0], outputs[3]),
+           "the accumulators round differently, case " + std::to_string(c));
+  }
+}
+
+// Every compact encoding: the decoded values within the precision of the format, encoded_bootstrap_kernel against
+// host_encoded_bootstrap_states bit for bit, and its means within the decoding error of the float bootstrap.
+static void check_encoded_kernel() {
+  const int replications = 100;
+  const int nr_values = 1001;
+  const size_t local_size = 32;
+  std::vector<float> values = test_values(nr_values);
+  for (int i = 0; i < nr_values; i++) {
+    values[i] = 100.0f * (values[i] - 50.0f);
+  }
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(3, 0, replications, &states[0]);
+  const input_encoding encodings[] = { ENCODING_HALF, ENCODING_BFLOAT16, ENCODING_INT8, ENCODING_INT16 };
+
+  for (int e = 0; e < 4; e++) {
+    encoded_values encoded;
+    encode_values(&values[0], nr_values, encodings[e], &encoded);
+    std::string name = input_encoding_name(encodings[e]);
+    // half and bfloat16 round to 11 and 8 significant bits, the affine codes to half a step
+    double max_error = 0;
+    bool round_trip = true;
+    for (int i = 0; i < nr_values; i++) {
+      double error = std::fabs(decode_value(encoded, i) - values[i]);
+      double allowed = (encodings[e] == ENCODING_HALF) ? std::ldexp(std::fabs(values[i]), -11)
+        : (encodings[e] == ENCODING_BFLOAT16) ? std::ldexp(std::fabs(values[i]), -8) : 0.5 * encoded.scale * (1 + 1e-6);
+      round_trip = round_trip && error <= allowed;
+      max_error = std::max(max_error, error);
+    }
+    expect(round_trip, name + " decodes within the precision of the format");
+
+    for (int subsample = 0; subsample < 2; subsample++) {
+      int m = subsample ? 700 : nr_values;
+      std::string variant = name + (subsample ? ", subsampling" : ", replacement");
+      std::vector<float> expected(replications);
+      host_encoded_bootstrap_states(&states[0], replications, encoded, nr_values, m, subsample != 0, &expected[0]);
+      std::vector<float> output(replications);
+      run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { encoded_bootstrap_kernel(&states[0], replications, &output[0], &encoded.bytes[0], nr_values, m, subsample, encodings[e], encoded.scale, encoded.offset); });
+      expect(same_floats(output, expected), "encoded_bootstrap_kernel against host_encoded_bootstrap_states, " + variant);
+
+      // the float sums of m draws of values up to 500 round by up to about m 2^-24 500 each
+      std::vector<float> plain(replications);
+      if (subsample) {
+        run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { subsample_kernel(&states[0], replications, &plain[0], &values[0], nr_values, m); });
+      } else {
+        run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { bootstrap_kernel(&states[0], replications, &plain[0], &values[0], nr_values, m); });
+      }
+      double allowed = max_error + 2.0 * m * std::ldexp(500.0, -24);
+      bool close = true;
+      for (int i = 0; i < replications; i++) {
+        close = close && std::fabs((double) output[i] - plain[i]) <= allowed;
+      }
+      expect(close, "encoded_bootstrap_kernel within the decoding error of bootstrap_kernel, " + variant);
+    }
+  }
+
+  bool rejected = false;
+  try {
+    encoded_values encoded;
+    encode_values(NULL, 0, ENCODING_INT8, &encoded);
+  } catch (const bootstrap_error&) {
+    rejected = true;
+  }
+  expect(rejected, "encode_values rejects an empty input");
+}
+
+// integer_bootstrap_kernel is exact: its means are the integer sums of the original values over the same draws,
+// rounded once. Counts spanning 200, 60000 and the whole int range take 1, 2 and 4 bytes, all with a negative offset.
+static void check_integer_kernel() {
+  const int replications = 100;
+  const int nr_values = 1001;
+  const size_t local_size = 32;
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(17, 0, replications, &states[0]);
+  const long long spans[] = { 200, 60000, 0xffffffffLL };
+  const int widths[] = { 1, 2, 4 };
+
+  for (int w = 0; w < 3; w++) {
+    std::vector<int> values(nr_values);
+    xorwow_state state;
+    xorwow_init(&state, 23, w);
+    long long low = (w == 2) ? INT_MIN : -spans[w] / 2;
+    for (int i = 0; i < nr_values; i++) {
+      values[i] = (int) (low + (long long) (xorwow_uniform(&state) * spans[w]));
+    }
+    values[0] = (int) low;
+    values[1] = (int) (low + spans[w]);
+    encoded_integers encoded;
+    encode_integers(&values[0], nr_values, &encoded);
+    std::string name = std::to_string(widths[w]) + "-byte counts";
+    expect(encoded.value_bytes == widths[w] && encoded.offset == low, name + " are packed with the minimum as offset");
+
+    for (int subsample = 0; subsample < 2; subsample++) {
+      int m = subsample ? 700 : nr_values;
+      std::string variant = name + (subsample ? ", subsampling" : ", replacement");
+      std::vector<float> exact(replications);
+      for (int i = 0; i < replications; i++) {
+        xorwow_state draws = states[i];
+        feistel_permutation_host permutation;
+        if (subsample) {
+          feistel_init(&permutation, &draws, nr_values);
+        }
+        long long sum = 0;
+        for (int j = 0; j < m; j++) {
+          sum += values[host_draw_index(&draws, &permutation, j, subsample != 0, nr_values)];
+        }
+        exact[i] = (float) ((double) sum / m);
+      }
+      std::vector<float> output(replications);
+      run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { integer_bootstrap_kernel(&states[0], replications, &output[0], &encoded.bytes[0], nr_values, m, subsample, encoded.value_bytes, encoded.offset); });
+      expect(same_floats(output, exact), "integer_bootstrap_kernel against the exact integer means, " + variant);
+      std::vector<float> host(replications);
+      host_integer_bootstrap_states(&states[0], replications, encoded, nr_values, m, subsample != 0, &host[0]);
+      expect(same_floats(host, exact), "host_integer_bootstrap_states against the exact integer means, " + variant);
+    }
+  }
+}
+
+// The compressed inputs of 0/1 values and of few distinct values draw counts instead of indices, with the hand-written
+// binomial samplers (inversion below n * p = 30, BTPE above), so they are compared with the exact distributions.
+static void check_compressed_samplers() {
+  const int replications = 50000;
+  const size_t local_size = 64;
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(2023, 0, replications, &states[0]);
+
+  // resample size, successes, nr of values: inversion, BTPE near and far from the mode (the recursive f(y) / f(m) and
+  // the squeeze with the Stirling bound) and p > 0.5, which draws the failures
+  const int cases[][3] = { { 50, 10, 100 }, { 1000, 30, 100 }, { 100000, 40, 100 }, { 1000, 70, 100 } };
+  for (int c = 0; c < 4; c++) {
+    int m = cases[c][0], successes = cases[c][1], nr_values = cases[c][2];
+    std::vector<float> means(replications);
+    run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { binomial_bootstrap_kernel(&states[0], replications, &means[0], successes, nr_values, m); });
+    std::string name = "Binomial(" + std::to_string(m) + ", " + std::to_string(successes) + "/" + std::to_string(nr_values) + ")";
+    expect(fits_distribution(sums_of_means(means, m), binomial_pmf(m, (double) successes / nr_values)), "binomial_bootstrap_kernel against " + name);
+
+    // two categories of value 1 and 0 are the same single binomial draw
+    float category_values[] = { 1.0f, 0.0f };
+    double conditional_probs[] = { (double) successes / nr_values, 1.0 };
+    std::vector<float> multinomial(replications);
+    run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { multinomial_bootstrap_kernel(&states[0], replications, &multinomial[0], category_values, 2, m, conditional_probs); });
+    expect(same_floats(multinomial, means), "multinomial_bootstrap_kernel with two categories against the binomial, " + name);
+  }
+
+  // three categories of value 1, 64 and 4096 with fewer than 64 draws, so each count can be read off the exact sum,
+  // and each count on its own is Binomial(m, p_c)
+  const int m = 63;
+  float category_values[] = { 1.0f, 64.0f, 4096.0f };
+  double probs[] = { 0.5, 0.3, 0.2 };
+  double conditional_probs[] = { 0.5, 0.3 / 0.5, 1.0 };
+  std::vector<float> means(replications);
+  run_ndrange(0, global_size_for(replications, local_size), local_size, [&] { multinomial_bootstrap_kernel(&states[0], replications, &means[0], category_values, 3, m, conditional_probs); });
+  std::vector<int> sums = sums_of_means(means, m);
+  std::vector<std::vector<int> > counts(3, std::vector<int>(replications));
+  bool complete = true;
+  for (int i = 0; i < replications; i++) {
+    counts[0][i] = sums[i] % 64;
+    counts[1][i] = sums[i] / 64 % 64;
+    counts[2][i] = sums[i] / 4096;
+    complete = complete && counts[0][i] + counts[1][i] + counts[2][i] == m;
+  }
+  expect(complete, "multinomial_bootstrap_kernel draws resample_size values");
+  for (int c = 0; c < 3; c++) {
+    expect(fits_distribution(counts[c], binomial_pmf(m, probs[c])), "multinomial_bootstrap_kernel, count of category " + std::to_string(c));
+  }
+}
+
+static void check_jackknife() {
+  const int nr_values = 500;
+  const size_t local_size = 64;
+  std::vector<float> values = test_values(nr_values);
+  double total = 0;
+  for (int i = 0; i < nr_values; i++) {
+    total += values[i];
+  }
+  std::vector<float> means(nr_values), variances(nr_values);
+  run_ndrange(0, global_size_for(nr_values, local_size), local_size, [&] { jackknife_mean_kernel(&values[0], nr_values, total, &means[0]); });
+  run_ndrange(0, global_size_for(nr_values, local_size), local_size, [&] { jackknife_var_kernel(&values[0], nr_values, &variances[0]); });
+
+  // each leave-one-out set in double and two passes; the sums of these floats are exact in double, so the means match
+  // bit for bit, the variance of the kernel is a float Welford recursion and agrees to about 1e-5
+  bool means_match = true;
+  double worst = 0;
+  for (int i = 0; i < nr_values; i++) {
+    double sum = 0;
+    for (int j = 0; j < nr_values; j++) {
+      sum += (j == i) ? 0 : values[j];
+    }
+    double mean = sum / (nr_values - 1);
+    double sum_sq = 0;
+    for (int j = 0; j < nr_values; j++) {
+      sum_sq += (j == i) ? 0 : (values[j] - mean) * (values[j] - mean);
+    }
+    double variance = sum_sq / (nr_values - 2);
+    means_match = means_match && means[i] == (float) mean;
+    worst = std::max(worst, fabs(variances[i] - variance) / variance);
+  }
+  expect(means_match, "jackknife_mean_kernel against the leave-one-out means");
+  expect(worst < 1e-4, "jackknife_var_kernel against the leave-one-out variances, relative error " + std::to_string(worst));
+}
+
+// summary_partial_kernel and histogram_kernel against host_summary_partials over the same means: minimum, maximum and
+// bin counts exactly, mean and standard error up to the order of the double sums. The maximum occurs several times
+// and has to be counted in the last bin. The cases have more items than means, items without a mean, local sizes
+// that are not a power of two and a single value.
+static void check_summary_kernels() {
+  struct summary_case { int count; size_t local_size; int nr_groups; int nr_bins; };
+  const summary_case cases[] = { { 3001, 48, 5, 37 }, { 100, 64, 4, 10 }, { 1000, 32, 1, 4096 }, { 50, 20, 3, 8 } };
+  const std::vector<double> probs = { 0.025, 0.5, 0.975 };
+  for (const summary_case& c : cases) {
+    std::vector<float> means(c.count);
+    xorwow_state state;
+    xorwow_init(&state, 29, c.count);
+    bool single_value = c.count == 50;
+    for (int i = 0; i < c.count; i++) {
+      means[i] = single_value ? 50.0f : 49.0f + 2.0f * xorwow_uniform(&state);
+    }
+    float high = *std::max_element(means.begin(), means.end());
+    means[c.count / 3] = high;
+    means[c.count - 1] = high;
+    std::string name = std::to_string(c.count) + " means, " + std::to_string(c.nr_bins) + " bins";
+
+    size_t global_size = c.nr_groups * c.local_size;
+    std::vector<double> partials(summary_moments * c.nr_groups);
+    std::vector<double> scratch(4 * c.local_size);
+    run_ndrange(0, global_size, c.local_size, [&] { summary_partial_kernel(&means[0], c.count, &partials[0], &scratch[0]); });
+    // one spare bin catches a mean counted past the last one
+    std::vector<unsigned int> histogram(c.nr_bins + 1, 0);
+    std::vector<unsigned int> local_bins(c.nr_bins + 1, 0);
+    run_ndrange(0, global_size, c.local_size, [&] { histogram_kernel(&means[0], c.count, &partials[0], c.nr_groups, c.nr_bins, &histogram[0], &local_bins[0]); });
+    expect(histogram[c.nr_bins] == 0 && local_bins[c.nr_bins] == 0, "histogram_kernel stays within the bins, " + name);
+    histogram.pop_back();
+
+    std::vector<double> host_partials;
+    std::vector<unsigned int> host_counts;
+    host_summary_partials(&means[0], c.count, c.nr_bins, &host_partials, &host_counts);
+    bootstrap_summary device = finish_summary(partials, histogram, c.count, probs);
+    bootstrap_summary host = finish_summary(host_partials, host_counts, c.count, probs);
+
+    expect(device.min == host.min && device.max == host.max && device.max == high, "summary_partial_kernel minimum and maximum, " + name);
+    expect(fabs(device.mean - host.mean) <= 1e-12 * fabs(host.mean), "summary_partial_kernel mean, " + name);
+    expect(fabs(device.se - host.se) <= 1e-9 * host.se + 1e-12, "summary_partial_kernel standard error, " + name);
+    expect(histogram == host_counts, "histogram_kernel against the host bin counts, " + name);
+    unsigned int total = 0;
+    for (unsigned int n : histogram) {
+      total += n;
+    }
+    int at_max = std::count(means.begin(), means.end(), high);
+    int last = single_value ? 0 : c.nr_bins - 1;
+    expect(total == (unsigned int) c.count && histogram[last] >= (unsigned int) at_max, "histogram_kernel counts every mean and the maximum in the last bin, " + name);
+    expect(device.quantiles == host.quantiles, "quantiles of the device summary, " + name);
+  }
+}
+
+static int check_device() {
+  const int replications = 1000;
+  const int seed = 2023;
+  std::unique_ptr<opencl_bootstrap_manager<float> > manager;
+  try {
+    manager.reset(new opencl_bootstrap_manager<float>(replications, seed));
+  } catch (const std::exception& e) {
+    printf("no OpenCL device, skipped: %s\n", e.what());
+    return 77;
+  }
+  cpu_bootstrap_manager<float> reference(replications, seed);
+  std::vector<float> values = test_values(5000);
+  manager->set_deterministic(true);
+  expect(same_floats(manager->get_bootstrapped_means(values), reference.get_bootstrapped_means(values)), "device against the reference, replacement");
+  manager->set_sampling_mode("subsampling");
+  manager->set_resample_size(1000);
+  reference.set_sampling_mode("subsampling");
+  reference.set_resample_size(1000);
+  expect(same_floats(manager->get_bootstrapped_means(values), reference.get_bootstrapped_means(values)), "device against the reference, subsampling");
+  manager->cleanup_device();
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  std::string mode = (argc > 1) ? argv[1] : "host";
+  if (mode == "device") {
+    return check_device();
+  }
+  check_rand_states();
+  check_samplers();
+  check_vec4_kernel();
+  check_group_kernel();
+  check_summation_kernel();
+  check_encoded_kernel();
+  check_integer_kernel();
+  check_compressed_samplers();
+  check_jackknife();
+  check_summary_kernels();
+  if (failures == 0) {
+    printf("all checks passed\n");
+  }
+  return failures ? 1 : 0;
+}
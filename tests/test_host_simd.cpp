@@ -0,0 +1,41 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <host_simd.h>
+
+// host_bootstrap_states against host_bootstrap_replication under the instruction set picked for this process,
+// ctest runs it once per FASTBOOTSTRAP_HOST_ISA value since the choice is made once
+
+int main() {
+  const int replications = 203;
+  const int nr_values = 1001;
+  const int resample_sizes[] = { nr_values, 257 };
+  std::vector<float> values(nr_values);
+  xorwow_state state;
+  xorwow_init(&state, 99, 0);
+  for (int i = 0; i < nr_values; i++) {
+    values[i] = 50.0f + 10.0f * (xorwow_uniform(&state) - 0.5f);
+  }
+  std::vector<xorwow_state> states(replications);
+  host_init_rand_states(2023, 0, replications, &states[0]);
+
+  int failures = 0;
+  for (int r = 0; r < 2; r++) {
+    int m = resample_sizes[r];
+    std::vector<float> output(replications);
+    host_bootstrap_states(&states[0], replications, &values[0], nr_values, m, &output[0]);
+    for (int i = 0; i < replications; i++) {
+      float expected = host_bootstrap_replication(states[i], &values[0], nr_values, m, false);
+      if (memcmp(&expected, &output[i], sizeof(float)) != 0) {
+        printf("FAILED: %s, resample size %d, replication %d: %.9g instead of %.9g\n", host_simd_isa(), m, i, output[i], expected);
+        failures++;
+        break;
+      }
+    }
+  }
+  if (failures == 0) {
+    printf("%s matches the scalar path\n", host_simd_isa());
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,19 @@
+#include <cstdio>
+
+#include <bootstrap_manager.h>
+#include <bootstrap_daemon.h>
+
+// the bootstrap daemon without R: fastbootstrapd <socket path>
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s <socket path>\n", argv[0]);
+    return 2;
+  }
+  try {
+    serve_bootstrap_daemon<opencl_bootstrap_manager_float, float>(argv[1]);
+  } catch (const std::exception& e) {
+    fprintf(stderr, "fastbootstrapd: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}